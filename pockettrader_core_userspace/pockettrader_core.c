@@ -10,11 +10,23 @@
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <pthread.h>
 #include <arpa/inet.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <sched.h>
+#include <locale.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+// Optional io_uring receive path (build with -DPOCKETTRADER_IO_URING
+// -luring).  Needs liburing and a >= 5.6 kernel, which the stock BBB
+// Debian image does not guarantee, so the recvmmsg loop stays the
+// default.
+#ifdef POCKETTRADER_IO_URING
+#include <liburing.h>
+#endif
 
 #include "pockettrader_state.h"
 
@@ -36,20 +48,31 @@ static volatile sig_atomic_t g_running = 1;
 // Shared memory pointer
 static PocketTraderShared *g_shared = NULL;
 
-// Latency log
-static FILE *g_latency_log = NULL;
+// Latency log (fd written only by the logger thread)
+static int g_latency_fd = -1;
 
 // Trade socket and address
 static int g_trade_sock = -1;
+static int g_trade_send_flags = 0;   // MSG_ZEROCOPY when --zerocopy is active
 static struct sockaddr_in g_trade_addr;
 static pthread_mutex_t g_trade_addr_mutex = PTHREAD_MUTEX_INITIALIZER;
 static int g_trade_addr_ready = 0;
 
+// Real-time priorities (SCHED_FIFO).  Feeds sit above the strategy
+// thread so market data always preempts the decision loop when both
+// share one isolated core (the AM3358 only has one).
+#define FEED_THREAD_RT_PRIO      81
+#define STRATEGY_THREAD_RT_PRIO  80
+
 // Core configuration
 typedef struct {
     int exa_port;
     int exb_port;
     int trade_port;
+    int rt_cpu;      // CPU to pin hot threads to, -1 = no pinning/RT
+    int zerocopy;    // 1 = send trades with MSG_ZEROCOPY
+    int ipc_shm;     // 1 = quotes arrive via the shared-memory rings, no UDP
+    char trade_host[64];  // TRADE destination; learned from feeds if empty
 } CoreConfig;
 
 // ------------- UTILS -------------
@@ -60,17 +83,97 @@ static void handle_signal(int sig) {
 }
 
 // Monotonic time in ns
-static uint64_t now_ns(void) {
+static uint64_t clock_monotonic_ns(void) {
     struct timespec ts;
     clock_gettime(CLOCK_MONOTONIC, &ts);
     return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
 }
 
-// Simple EMA helper
+// On x86-64 hosts (development / sim runs) an invariant TSC is assumed
+// and now_ns() becomes a calibrated rdtsc read — roughly a quarter of
+// the cost of the vDSO clock_gettime and non-serializing.  ns-per-tick
+// is captured once at startup as a 32.32 fixed-point multiplier against
+// CLOCK_MONOTONIC.  The BBB's Cortex-A8 exposes no comparable userspace
+// counter, so ARM builds keep clock_gettime.
+#if defined(__x86_64__)
+#include <x86intrin.h>
+
+static uint64_t g_tsc_epoch_ns;      // CLOCK_MONOTONIC at calibration
+static uint64_t g_tsc_epoch_ticks;   // rdtsc at calibration
+static uint64_t g_ns_per_tick_fx;    // ns per TSC tick, 32.32 fixed point
+
+static void calibrate_now_ns(void) {
+    uint64_t t0_ns = clock_monotonic_ns();
+    uint64_t t0_tk = __rdtsc();
+    struct timespec ts = {0, 20000000};  // 20 ms window
+    nanosleep(&ts, NULL);
+    uint64_t t1_ns = clock_monotonic_ns();
+    uint64_t t1_tk = __rdtsc();
+
+    g_tsc_epoch_ns    = t1_ns;
+    g_tsc_epoch_ticks = t1_tk;
+    g_ns_per_tick_fx  = (uint64_t)(((unsigned __int128)(t1_ns - t0_ns) << 32)
+                                   / (t1_tk - t0_tk));
+}
+
+static inline uint64_t now_ns(void) {
+    uint64_t dt = __rdtsc() - g_tsc_epoch_ticks;
+    return g_tsc_epoch_ns +
+           (uint64_t)(((unsigned __int128)dt * g_ns_per_tick_fx) >> 32);
+}
+#else
+static void calibrate_now_ns(void) {}
+
+static inline uint64_t now_ns(void) {
+    return clock_monotonic_ns();
+}
+#endif
+
+// One spin-wait pause hint: x86 PAUSE / ARM YIELD, no-op elsewhere.
+static inline void cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__arm__) || defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// Kernel sleep until the feed notification word changes from `seen_seq`,
+// capped at 100 µs so staleness/kill-switch checks keep running while
+// the feeds are quiet.  Non-private futex because the word lives in the
+// shared mapping (the GUI may eventually wait on it too).
+static void feed_seq_futex_wait(uint32_t seen_seq) {
+    struct timespec timeout = { 0, 100000 };
+    syscall(SYS_futex, &g_shared->feed_seq, FUTEX_WAIT,
+            seen_seq, &timeout, NULL, 0);
+}
+
+static void feed_seq_futex_wake(void) {
+    syscall(SYS_futex, &g_shared->feed_seq, FUTEX_WAKE,
+            1, NULL, NULL, 0);
+}
+
+// Strategy-side wait: a bounded PAUSE spin first (the next tick is
+// usually microseconds away), then the futex fallback.  Replaces
+// sched_yield(), which handed the CPU back to the scheduler even when
+// an update was imminent.
+static void strategy_wait_for_update(uint32_t seen_seq) {
+    for (int i = 0; i < 1024; ++i) {
+        if (__atomic_load_n(&g_shared->feed_seq, __ATOMIC_RELAXED) != seen_seq) {
+            return;
+        }
+        cpu_relax();
+    }
+    feed_seq_futex_wait(seen_seq);
+}
+
+// Integer EMA with alpha = 1/16: new = old - old/16 + sample/16.
+// Two shifts and two adds keep the FPU out of the ingest path; for
+// tick-interval magnitudes (micro- to milliseconds) the truncation
+// error is noise.
 static uint64_t ema_ns(uint64_t old_avg, uint64_t sample) {
     if (old_avg == 0) return sample;
-    double a = 0.1;
-    return (uint64_t)((1.0 - a) * (double)old_avg + a * (double)sample);
+    return old_avg - (old_avg >> 4) + (sample >> 4);
 }
 
 // Shared memory init
@@ -133,14 +236,15 @@ static void init_shared_memory(void) {
 
         g_shared->magic = POCKETTRADER_SHM_MAGIC;
 
-        if (pthread_mutex_lock(&g_shared->mutex) == 0) {
+        pockettrader_write_lock(g_shared);
+        {
             PocketTraderState *st = &g_shared->state;
             memset(st, 0, sizeof(*st));
             st->min_spread    = 0.10;  // default threshold
             st->strategy_mode = 2;     // PAPER
             st->trade_size    = 0.01;  // 0.01 BTC
-            pthread_mutex_unlock(&g_shared->mutex);
         }
+        pockettrader_write_unlock(g_shared);
     } else {
         while (g_shared->magic != POCKETTRADER_SHM_MAGIC) {
             struct timespec ts = {0, 1000000};
@@ -149,6 +253,35 @@ static void init_shared_memory(void) {
     }
 }
 
+// ---------- GUI wakeup FIFO ----------
+
+// One-byte pokes through a named FIFO let the GUI sleep in its event
+// loop until fresh state exists instead of polling on a timer.  Opened
+// O_RDWR so the open never blocks and writes never fail just because no
+// GUI is attached; O_NONBLOCK so a full pipe (GUI asleep or gone) costs
+// an EAGAIN, never a stall.
+static int g_ui_wake_fd = -1;
+
+#define UI_WAKE_INTERVAL_NS 20000000ULL   // coalesce pokes to ~50 Hz
+
+static void init_ui_wake_fifo(void) {
+    if (mkfifo(POCKETTRADER_UI_WAKE_FIFO, 0666) < 0 && errno != EEXIST) {
+        perror("mkfifo ui wake (continuing without GUI wakeups)");
+        return;
+    }
+    g_ui_wake_fd = open(POCKETTRADER_UI_WAKE_FIFO, O_RDWR | O_NONBLOCK);
+    if (g_ui_wake_fd < 0) {
+        perror("open ui wake fifo (continuing without GUI wakeups)");
+    }
+}
+
+static void ui_wake(void) {
+    char b = 0;
+    if (write(g_ui_wake_fd, &b, 1) < 0) {
+        // EAGAIN = pipe full, the GUI has wakeups pending already.
+    }
+}
+
 // ---------- Feed receiver thread ----------
 
 typedef struct {
@@ -157,106 +290,290 @@ typedef struct {
     CoreConfig *config;
 } FeedThreadArgs;
 
+// Parsed TICK, staged between syscall and state update
+typedef struct {
+    double bid;
+    double ask;
+    uint64_t seq;
+} ParsedTick;
+
+// ---------- TICK parsing ----------
+
+// Cached "C" numeric locale so strtod_l never touches the global locale
+// (and its lock) on the per-tick path.  Created once in main().
+static locale_t g_c_numeric_locale;
+
+static int parse_u64(const char **pp, uint64_t *out) {
+    const char *p = *pp;
+    while (*p == ' ') p++;
+    if (*p < '0' || *p > '9') return -1;
+    uint64_t v = 0;
+    do {
+        v = v * 10u + (uint64_t)(*p - '0');
+        p++;
+    } while (*p >= '0' && *p <= '9');
+    *pp = p;
+    *out = v;
+    return 0;
+}
+
+static int parse_field_double(const char **pp, double *out) {
+    const char *p = *pp;
+    while (*p == ' ') p++;
+    char *end = NULL;
+    double v = strtod_l(p, &end, g_c_numeric_locale);
+    if (end == p) return -1;
+    *pp = end;
+    *out = v;
+    return 0;
+}
+
+// Specialized parser for the feed wire format produced by exchange_sim.py:
+//   TICK <EXCH> <SYMBOL> <bid> <ask> <seq> <ts_ns>
+// Much cheaper than sscanf: no format-string walk, no locale lookup per
+// call.  The exchange token is not inspected — each feed socket carries
+// exactly one exchange, so dispatch already happened at bind time.
+// Returns 0 on success.
+static int parse_tick(const char *buf, ParsedTick *out, uint64_t *ts_ns) {
+    if (memcmp(buf, "TICK ", 5) != 0) return -1;
+    const char *p = buf + 5;
+
+    // skip exchange token
+    while (*p && *p != ' ') p++;
+    if (*p != ' ') return -1;
+    p++;
+
+    // skip symbol token
+    while (*p && *p != ' ') p++;
+    if (*p != ' ') return -1;
+
+    if (parse_field_double(&p, &out->bid) < 0) return -1;
+    if (parse_field_double(&p, &out->ask) < 0) return -1;
+    if (parse_u64(&p, &out->seq) < 0) return -1;
+    if (parse_u64(&p, ts_ns) < 0) return -1;
+    return 0;
+}
+
+// Datagrams drained per recvmmsg call
+#define FEED_BATCH 32
+
 static void *feed_receiver_thread(void *arg) {
     FeedThreadArgs *fta = (FeedThreadArgs *)arg;
     int sock   = fta->sock;
     int is_exa = fta->is_exa;
 
-    char buf[256];
-    struct sockaddr_in src_addr;
-    socklen_t addrlen = sizeof(src_addr);
+    // recvmmsg scatter arrays, wired up once outside the loop
+    static __thread char bufs[FEED_BATCH][256];
+    struct iovec       iov[FEED_BATCH];
+    struct mmsghdr     msgs[FEED_BATCH];
+    struct sockaddr_in addrs[FEED_BATCH];
+    ParsedTick         ticks[FEED_BATCH];
+
+    memset(msgs, 0, sizeof(msgs));
+    for (int i = 0; i < FEED_BATCH; ++i) {
+        iov[i].iov_base = bufs[i];
+        iov[i].iov_len  = sizeof(bufs[i]) - 1;
+        msgs[i].msg_hdr.msg_iov     = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen  = 1;
+        msgs[i].msg_hdr.msg_name    = &addrs[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+    }
 
     while (g_running) {
-        ssize_t n = recvfrom(sock,
-                             buf,
-                             sizeof(buf) - 1,
-                             0,
-                             (struct sockaddr *)&src_addr,
-                             &addrlen);
+        // The kernel rewrites msg_namelen per datagram; restore before reuse.
+        for (int i = 0; i < FEED_BATCH; ++i) {
+            msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+        }
+
+        // One syscall drains up to FEED_BATCH queued datagrams; blocks
+        // only until the first one arrives.
+        int n = recvmmsg(sock, msgs, FEED_BATCH, MSG_WAITFORONE, NULL);
         if (n < 0) {
             if (errno == EINTR) {
                 continue;
             }
-            perror("recvfrom feed");
+            perror("recvmmsg feed");
             break;
         }
         if (n == 0) {
             continue;
         }
 
-        buf[n] = '\0';
-
-        // Expected: TICK EXA BTCUSD <bid> <ask> <seq> <ts_ns>
-        char exch[8]    = {0};
-        char symbol[16] = {0};
-        double bid      = 0.0;
-        double ask      = 0.0;
-        unsigned long long seq_ull   = 0;
-        unsigned long long ts_ns_ull = 0;
-
-        int scanned = sscanf(buf,
-                             "TICK %7s %15s %lf %lf %llu %llu",
-                             exch,
-                             symbol,
-                             &bid,
-                             &ask,
-                             &seq_ull,
-                             &ts_ns_ull);
-        if (scanned < 6) {
-            fprintf(stderr, "Bad TICK message: %s\n", buf);
-            continue;
-        }
+        uint64_t t_recv = now_ns();  // BBB receive time (monotonic), per batch
+
+        int parsed = 0;
+        for (int i = 0; i < n; ++i) {
+            char *buf = bufs[i];
+            buf[msgs[i].msg_len] = '\0';
+
+            uint64_t ts_ns = 0;
+            if (parse_tick(buf, &ticks[parsed], &ts_ns) != 0) {
+                fprintf(stderr, "Bad TICK message: %s\n", buf);
+                continue;
+            }
 
 #if DEBUG_TICKS
-        fprintf(stdout,
-                "[%s] TICK %s bid=%.2f ask=%.2f seq=%llu\n",
-                is_exa ? "EXA" : "EXB",
-                symbol,
-                bid,
-                ask,
-                (unsigned long long)seq_ull);
-        fflush(stdout);
+            fprintf(stdout,
+                    "[%s] TICK bid=%.2f ask=%.2f seq=%llu\n",
+                    is_exa ? "EXA" : "EXB",
+                    ticks[parsed].bid,
+                    ticks[parsed].ask,
+                    (unsigned long long)ticks[parsed].seq);
+            fflush(stdout);
 #endif
 
-        uint64_t t_recv = now_ns();  // BBB receive time (monotonic)
+            parsed++;
+        }
+
+        if (parsed == 0) {
+            continue;
+        }
 
-        if (pthread_mutex_lock(&g_shared->mutex) == 0) {
-            PocketTraderState *st = &g_shared->state;
-            ExchangeQuote *q = is_exa ? &st->exa : &st->exb;
+        // Publish the batch through this exchange's SPSC ring.  The feed
+        // thread no longer touches PocketTraderState at all: the strategy
+        // thread is the only state writer, so producer and consumer only
+        // share the ring's head/tail words and the slots themselves.
+        QuoteRing *ring = is_exa ? &g_shared->exa_ring : &g_shared->exb_ring;
+        ExchangeQuote q;
+        memset(&q, 0, sizeof(q));
+        q.last_update_ns = t_recv;
+        q.connected      = 1;
+        for (int i = 0; i < parsed; ++i) {
+            q.bid = ticks[i].bid;
+            q.ask = ticks[i].ask;
+            q.seq = ticks[i].seq;
+            quote_ring_push(ring, &q);
+        }
+
+        // Rouse the strategy thread if it fell back to the futex.
+        __atomic_fetch_add(&g_shared->feed_seq, 1, __ATOMIC_RELEASE);
+        feed_seq_futex_wake();
+
+        // Initialize trade target IP from first packet
+        if (!g_trade_addr_ready) {
+            if (pthread_mutex_lock(&g_trade_addr_mutex) == 0) {
+                if (!g_trade_addr_ready) {
+                    memset(&g_trade_addr, 0, sizeof(g_trade_addr));
+                    g_trade_addr.sin_family = AF_INET;
+                    g_trade_addr.sin_addr   = addrs[0].sin_addr;
+                    g_trade_addr_ready      = 1;
+                }
+                pthread_mutex_unlock(&g_trade_addr_mutex);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+#ifdef POCKETTRADER_IO_URING
+
+// io_uring feed loop: FEED_BATCH recvmsg SQEs stay outstanding per
+// socket, so a burst of queued datagrams completes with at most one
+// io_uring_enter per drain instead of one syscall per recv* call.
+// Publication into the quote ring is identical to the recvmmsg path.
+static void *feed_receiver_thread_uring(void *arg) {
+    FeedThreadArgs *fta = (FeedThreadArgs *)arg;
+    int sock   = fta->sock;
+    int is_exa = fta->is_exa;
+
+    static __thread char bufs[FEED_BATCH][256];
+    struct iovec       iov[FEED_BATCH];
+    struct msghdr      hdrs[FEED_BATCH];
+    struct sockaddr_in addrs[FEED_BATCH];
+    ParsedTick         ticks[FEED_BATCH];
+
+    struct io_uring ring;
+    int err = io_uring_queue_init(2 * FEED_BATCH, &ring, 0);
+    if (err < 0) {
+        fprintf(stderr, "io_uring_queue_init: %s\n", strerror(-err));
+        return NULL;
+    }
+
+    memset(hdrs, 0, sizeof(hdrs));
+    for (unsigned i = 0; i < FEED_BATCH; ++i) {
+        iov[i].iov_base     = bufs[i];
+        iov[i].iov_len      = sizeof(bufs[i]) - 1;
+        hdrs[i].msg_iov     = &iov[i];
+        hdrs[i].msg_iovlen  = 1;
+        hdrs[i].msg_name    = &addrs[i];
+        hdrs[i].msg_namelen = sizeof(addrs[i]);
+
+        struct io_uring_sqe *sqe = io_uring_get_sqe(&ring);
+        io_uring_prep_recvmsg(sqe, sock, &hdrs[i], 0);
+        io_uring_sqe_set_data64(sqe, (uint64_t)i);
+    }
+    io_uring_submit(&ring);
 
-            uint64_t interval_ns = 0;
-            if (q->last_update_ns != 0 && t_recv > q->last_update_ns) {
-                interval_ns = t_recv - q->last_update_ns;
+    while (g_running) {
+        struct io_uring_cqe *cqe = NULL;
+        err = io_uring_wait_cqe(&ring, &cqe);
+        if (err < 0) {
+            if (err == -EINTR) {
+                continue;
             }
+            fprintf(stderr, "io_uring_wait_cqe: %s\n", strerror(-err));
+            break;
+        }
+
+        uint64_t t_recv = now_ns();
+        int parsed  = 0;
+        unsigned handled = 0;
+        unsigned head;
 
-            q->bid            = bid;
-            q->ask            = ask;
-            q->seq            = (uint64_t)seq_ull;
-            q->last_update_ns = t_recv;
-            q->connected      = 1;
-
-            if (interval_ns > 0) {
-                if (is_exa) {
-                    st->last_tick_latency_exa_ns = interval_ns;
-                    st->avg_tick_latency_exa_ns  =
-                        ema_ns(st->avg_tick_latency_exa_ns, interval_ns);
+        io_uring_for_each_cqe(&ring, head, cqe) {
+            unsigned idx = (unsigned)io_uring_cqe_get_data64(cqe);
+            int res = cqe->res;
+
+            if (res > 0 && parsed < FEED_BATCH) {
+                bufs[idx][res] = '\0';
+                uint64_t ts_ns = 0;
+                if (parse_tick(bufs[idx], &ticks[parsed], &ts_ns) == 0) {
+                    parsed++;
                 } else {
-                    st->last_tick_latency_exb_ns = interval_ns;
-                    st->avg_tick_latency_exb_ns  =
-                        ema_ns(st->avg_tick_latency_exb_ns, interval_ns);
+                    fprintf(stderr, "Bad TICK message: %s\n", bufs[idx]);
                 }
+            } else if (res < 0 && res != -EINTR) {
+                fprintf(stderr, "io_uring recvmsg: %s\n", strerror(-res));
             }
 
-            pthread_mutex_unlock(&g_shared->mutex);
+            // Re-arm the slot.
+            hdrs[idx].msg_namelen = sizeof(addrs[idx]);
+            struct io_uring_sqe *sqe = io_uring_get_sqe(&ring);
+            if (sqe) {
+                io_uring_prep_recvmsg(sqe, sock, &hdrs[idx], 0);
+                io_uring_sqe_set_data64(sqe, (uint64_t)idx);
+            }
+            handled++;
         }
+        io_uring_cq_advance(&ring, handled);
+        io_uring_submit(&ring);
+
+        if (parsed == 0) {
+            continue;
+        }
+
+        QuoteRing *qring = is_exa ? &g_shared->exa_ring : &g_shared->exb_ring;
+        ExchangeQuote q;
+        memset(&q, 0, sizeof(q));
+        q.last_update_ns = t_recv;
+        q.connected      = 1;
+        for (int i = 0; i < parsed; ++i) {
+            q.bid = ticks[i].bid;
+            q.ask = ticks[i].ask;
+            q.seq = ticks[i].seq;
+            quote_ring_push(qring, &q);
+        }
+
+        __atomic_fetch_add(&g_shared->feed_seq, 1, __ATOMIC_RELEASE);
+        feed_seq_futex_wake();
 
-        // Initialize trade target IP from first packet
         if (!g_trade_addr_ready) {
             if (pthread_mutex_lock(&g_trade_addr_mutex) == 0) {
                 if (!g_trade_addr_ready) {
                     memset(&g_trade_addr, 0, sizeof(g_trade_addr));
                     g_trade_addr.sin_family = AF_INET;
-                    g_trade_addr.sin_addr   = src_addr.sin_addr;
+                    g_trade_addr.sin_addr   = addrs[0].sin_addr;
                     g_trade_addr_ready      = 1;
                 }
                 pthread_mutex_unlock(&g_trade_addr_mutex);
@@ -264,6 +581,182 @@ static void *feed_receiver_thread(void *arg) {
         }
     }
 
+    io_uring_queue_exit(&ring);
+    return NULL;
+}
+
+#endif  // POCKETTRADER_IO_URING
+
+// ---------- TRADE serialization ----------
+
+// Hand-rolled formatters for the TRADE wire format.  The message stays
+// ASCII (trade_bridge.py parses it as text), but snprintf's per-call
+// format-string interpretation and locale checks are gone: literals go
+// out via memcpy and numbers via fixed-point integer emitters.
+
+static char *fmt_lit(char *p, const char *s, size_t n) {
+    memcpy(p, s, n);
+    return p + n;
+}
+
+static char *fmt_u64(char *p, uint64_t v) {
+    char tmp[20];
+    int n = 0;
+    do {
+        tmp[n++] = (char)('0' + (v % 10u));
+        v /= 10u;
+    } while (v);
+    while (n) *p++ = tmp[--n];
+    return p;
+}
+
+// Exactly six decimal places, matching the old "%.6f".  Rounds half
+// away from zero in micro-units; fine for the magnitudes this demo
+// produces (prices ~1e5, sizes/spreads well below that).
+static char *fmt_fixed6(char *p, double v) {
+    if (v < 0.0) {
+        *p++ = '-';
+        v = -v;
+    }
+    uint64_t u    = (uint64_t)(v * 1e6 + 0.5);
+    uint64_t ip   = u / 1000000ULL;
+    unsigned frac = (unsigned)(u % 1000000ULL);
+
+    p = fmt_u64(p, ip);
+    *p++ = '.';
+    for (int i = 5; i >= 0; --i) {
+        p[i] = (char)('0' + (frac % 10u));
+        frac /= 10u;
+    }
+    return p + 6;
+}
+
+// ---------- Specialized TRADE formatters ----------
+
+// The TRADE line is static except for the direction (which exchange is
+// bought) and the numeric fields; sides are always BUY then SELL.  One
+// specialized formatter per direction bakes every literal into a
+// fmt_lit/memcpy chunk, so after the branchless spread selection the hot
+// path is a single indirect call with no string branches.
+typedef struct {
+    double   buy_px;
+    double   sell_px;
+    double   size;
+    double   spread;
+    uint64_t ts_ns;
+} TradeCtx;
+
+// Numeric tail shared by both orientations:
+// <sell_px> <size> <spread> <ts_ns>
+static inline int fmt_trade_tail(char *buf, char *p, const TradeCtx *c) {
+    p = fmt_fixed6(p, c->sell_px); *p++ = ' ';
+    p = fmt_fixed6(p, c->size);    *p++ = ' ';
+    p = fmt_fixed6(p, c->spread);  *p++ = ' ';
+    p = fmt_u64(p, c->ts_ns);
+    *p = '\0';
+    return (int)(p - buf);
+}
+
+static int fmt_trade_buy_exa(char *buf, const TradeCtx *c) {
+    char *p = buf;
+    p = fmt_lit(p, "TRADE ARB1 EXA BUY ", 19);
+    p = fmt_fixed6(p, c->buy_px);
+    p = fmt_lit(p, " EXB SELL ", 10);
+    return fmt_trade_tail(buf, p, c);
+}
+
+static int fmt_trade_buy_exb(char *buf, const TradeCtx *c) {
+    char *p = buf;
+    p = fmt_lit(p, "TRADE ARB1 EXB BUY ", 19);
+    p = fmt_fixed6(p, c->buy_px);
+    p = fmt_lit(p, " EXA SELL ", 10);
+    return fmt_trade_tail(buf, p, c);
+}
+
+// Indexed by the spread-selection dir (1 = buy EXA, sell EXB).
+static int (*const g_fmt_trade[2])(char *, const TradeCtx *) = {
+    fmt_trade_buy_exb,
+    fmt_trade_buy_exa,
+};
+
+// ---------- Latency logging ----------
+
+// The strategy thread formats one fixed-size CSV line per trade into a
+// lock-free SPSC ring; a background logger thread drains it in writev
+// batches and fdatasyncs once a second.  No buffer flush or write
+// syscall remains on the trade path.  If the logger ever lags a full
+// ring, lines are dropped rather than blocking the strategy.
+
+#define LAT_LOG_RING_SIZE 1024u   // power of two
+#define LAT_LOG_LINE_MAX  128
+#define LAT_LOG_BATCH     64
+
+static char     g_lat_lines[LAT_LOG_RING_SIZE][LAT_LOG_LINE_MAX];
+static uint8_t  g_lat_lens[LAT_LOG_RING_SIZE];
+static uint64_t g_lat_head;       // producer index (strategy thread)
+static uint64_t g_lat_tail;       // consumer index (logger thread)
+
+static void latency_log_append(uint64_t t_log,
+                               uint64_t tick_to_trade_ns,
+                               uint64_t exa_avg_ns,
+                               uint64_t exb_avg_ns) {
+    uint64_t h = __atomic_load_n(&g_lat_head, __ATOMIC_RELAXED);
+    uint64_t t = __atomic_load_n(&g_lat_tail, __ATOMIC_ACQUIRE);
+    if (h - t >= LAT_LOG_RING_SIZE) {
+        return;  // logger lagging badly; drop rather than stall trading
+    }
+
+    unsigned idx = (unsigned)(h & (LAT_LOG_RING_SIZE - 1u));
+    char *line = g_lat_lines[idx];
+    char *p = line;
+    p = fmt_u64(p, t_log);            *p++ = ',';
+    p = fmt_u64(p, tick_to_trade_ns); *p++ = ',';
+    p = fmt_u64(p, exa_avg_ns);       *p++ = ',';
+    p = fmt_u64(p, exb_avg_ns);       *p++ = '\n';
+    g_lat_lens[idx] = (uint8_t)(p - line);
+
+    __atomic_store_n(&g_lat_head, h + 1, __ATOMIC_RELEASE);
+}
+
+static void *latency_logger_thread(void *arg) {
+    (void)arg;
+
+    uint64_t last_sync_ns = now_ns();
+    struct iovec iov[LAT_LOG_BATCH];
+
+    for (;;) {
+        uint64_t t = __atomic_load_n(&g_lat_tail, __ATOMIC_RELAXED);
+        uint64_t h = __atomic_load_n(&g_lat_head, __ATOMIC_ACQUIRE);
+
+        if (h == t) {
+            if (!g_running) {
+                break;
+            }
+            struct timespec ts = {0, 10000000};  // 10 ms
+            nanosleep(&ts, NULL);
+            continue;
+        }
+
+        int k = 0;
+        while (t + (uint64_t)k < h && k < LAT_LOG_BATCH) {
+            unsigned idx = (unsigned)((t + (uint64_t)k) & (LAT_LOG_RING_SIZE - 1u));
+            iov[k].iov_base = g_lat_lines[idx];
+            iov[k].iov_len  = g_lat_lens[idx];
+            k++;
+        }
+
+        if (g_latency_fd >= 0 && writev(g_latency_fd, iov, k) < 0) {
+            perror("writev latency log");
+        }
+        __atomic_store_n(&g_lat_tail, t + (uint64_t)k, __ATOMIC_RELEASE);
+
+        uint64_t t_now = now_ns();
+        if (g_latency_fd >= 0 && t_now - last_sync_ns >= 1000000000ULL) {
+            last_sync_ns = t_now;
+            fdatasync(g_latency_fd);
+        }
+    }
+
     return NULL;
 }
 
@@ -273,13 +766,182 @@ typedef struct {
     CoreConfig *config;
 } StrategyThreadArgs;
 
+// Outbound TRADE batcher, owned by the strategy thread.  Messages
+// produced within one iteration accumulate here and go out in a single
+// sendmmsg; the common single-trade case keeps the sendto fast path so
+// lone trades pay no extra latency.
+typedef struct {
+    char           bufs[MAX_TRADES_PER_SECOND][256];
+    struct iovec   iov[MAX_TRADES_PER_SECOND];
+    struct mmsghdr msgs[MAX_TRADES_PER_SECOND];
+    int            start;   // first slot of the pending batch
+    int            count;
+} TradeBatch;
+
+static void trade_batch_init(TradeBatch *b) {
+    memset(b->msgs, 0, sizeof(b->msgs));
+    for (int i = 0; i < MAX_TRADES_PER_SECOND; ++i) {
+        b->iov[i].iov_base = b->bufs[i];
+        b->iov[i].iov_len  = 0;
+        b->msgs[i].msg_hdr.msg_iov    = &b->iov[i];
+        b->msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    b->start = 0;
+    b->count = 0;
+}
+
+// Next free message buffer, or NULL when the batch is full.  Slots
+// rotate across flushes rather than restarting at 0 so a buffer is not
+// rewritten until MAX_TRADES_PER_SECOND-1 later sends have gone out —
+// required for MSG_ZEROCOPY, where the kernel may still be reading the
+// page after sendto returns.
+static char *trade_batch_slot(TradeBatch *b) {
+    if (b->start + b->count >= MAX_TRADES_PER_SECOND) return NULL;
+    return b->bufs[b->start + b->count];
+}
+
+static void trade_batch_commit(TradeBatch *b, int len) {
+    b->iov[b->start + b->count].iov_len = (size_t)len;
+    b->count++;
+}
+
+// Flush all pending messages to one destination.  Returns the number of
+// messages handed to the kernel, or -1 on error.
+static int trade_batch_flush(TradeBatch *b, struct sockaddr_in *addr) {
+    int sent_count;
+
+    if (b->count == 0) {
+        return 0;
+    }
+
+    if (b->count == 1) {
+        ssize_t sent = sendto(g_trade_sock,
+                              b->bufs[b->start],
+                              b->iov[b->start].iov_len,
+                              g_trade_send_flags,
+                              (struct sockaddr *)addr,
+                              sizeof(*addr));
+        sent_count = (sent < 0) ? -1 : 1;
+    } else {
+        for (int i = b->start; i < b->start + b->count; ++i) {
+            b->msgs[i].msg_hdr.msg_name    = addr;
+            b->msgs[i].msg_hdr.msg_namelen = sizeof(*addr);
+        }
+        sent_count = sendmmsg(g_trade_sock, &b->msgs[b->start],
+                              (unsigned)b->count, g_trade_send_flags);
+    }
+
+    b->start += b->count;
+    if (b->start >= MAX_TRADES_PER_SECOND) {
+        b->start = 0;
+    }
+    b->count = 0;
+    return sent_count;
+}
+
+// MSG_ZEROCOPY completions arrive on the socket error queue and must be
+// reaped or the kernel's optmem budget fills and sends fall back to
+// copying.  A dedicated low-duty thread drains them; the contents are
+// irrelevant here, only the dequeue matters.
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+static void *zerocopy_reap_thread(void *arg) {
+    (void)arg;
+
+    while (g_running) {
+        struct msghdr msg;
+        char ctrl[128];
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control    = ctrl;
+        msg.msg_controllen = sizeof(ctrl);
+
+        if (recvmsg(g_trade_sock, &msg, MSG_ERRQUEUE) < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                struct timespec ts = {0, 10000000};  // 10 ms
+                nanosleep(&ts, NULL);
+                continue;
+            }
+            break;
+        }
+    }
+
+    return NULL;
+}
+#endif
+
+// Post-trade state writeback, precomputed outside the write lock.  The
+// strategy thread is the only writer of these fields, so the running
+// totals can be derived from its own snapshot before the lock is taken;
+// under the lock the update collapses to straight stores.
+typedef struct {
+    double   last_spread_exa_to_exb;
+    double   last_spread_exb_to_exa;
+    uint64_t last_trade_ts_ns;
+    uint64_t last_tick_to_trade_ns;
+    double   last_trade_pnl;
+    double   cumulative_pnl;
+    uint32_t trades_count;
+    double   gross_profit;
+    double   gross_loss;
+    uint32_t winning_trades;
+    uint32_t losing_trades;
+    double   equity_high;
+    double   max_drawdown;
+    int      trip_circuit;
+} TradeDelta;
+
+static void apply_trade_delta(PocketTraderState *st, const TradeDelta *d) {
+    st->last_spread_exa_to_exb = d->last_spread_exa_to_exb;
+    st->last_spread_exb_to_exa = d->last_spread_exb_to_exa;
+    st->last_trade_ts_ns       = d->last_trade_ts_ns;
+    st->last_tick_to_trade_ns  = d->last_tick_to_trade_ns;
+    st->last_trade_pnl         = d->last_trade_pnl;
+    st->cumulative_pnl         = d->cumulative_pnl;
+    st->trades_count           = d->trades_count;
+    st->gross_profit           = d->gross_profit;
+    st->gross_loss             = d->gross_loss;
+    st->winning_trades         = d->winning_trades;
+    st->losing_trades          = d->losing_trades;
+    st->equity_high            = d->equity_high;
+    st->max_drawdown           = d->max_drawdown;
+    if (d->trip_circuit) {
+        // The GUI clears these without the mutex (circuit reset), so the
+        // stores are atomic on both sides; last writer wins, and trading
+        // stays gated on circuit_tripped either way.
+        __atomic_store_n(&st->circuit_tripped, 1, __ATOMIC_RELEASE);
+        __atomic_store_n(&st->strategy_mode, 0, __ATOMIC_RELEASE);
+    }
+}
+
+// Fold a ring quote into the published per-exchange slot.  Ring quotes
+// carry no interval metrics, so the running values are carried forward
+// across the overwrite and updated when the new tick yields an interval.
+static void fold_quote(ExchangeQuote *dst, ExchangeQuote *q) {
+    uint64_t interval_ns = 0;
+    if (dst->last_update_ns != 0 && q->last_update_ns > dst->last_update_ns) {
+        interval_ns = q->last_update_ns - dst->last_update_ns;
+    }
+
+    q->last_tick_interval_ns = dst->last_tick_interval_ns;
+    q->avg_tick_interval_ns  = dst->avg_tick_interval_ns;
+    if (interval_ns > 0) {
+        q->last_tick_interval_ns = interval_ns;
+        q->avg_tick_interval_ns  = ema_ns(q->avg_tick_interval_ns, interval_ns);
+    }
+
+    *dst = *q;
+}
+
 static void *strategy_thread(void *arg) {
     StrategyThreadArgs *sta = (StrategyThreadArgs *)arg;
     CoreConfig *cfg = sta->config;
 
     uint64_t current_second_start_ns = now_ns();
+    uint64_t last_ui_wake_ns = 0;
     int trades_in_current_second = 0;
 
+    TradeBatch batch;
+    trade_batch_init(&batch);
+
     while (g_running) {
         uint64_t t_now = now_ns();
 
@@ -288,21 +950,48 @@ static void *strategy_thread(void *arg) {
             trades_in_current_second = 0;
         }
 
-        PocketTraderState snapshot;
-        memset(&snapshot, 0, sizeof(snapshot));
+        // Feed sequence we acted on; waits below block until it moves.
+        uint32_t seen_seq =
+            __atomic_load_n(&g_shared->feed_seq, __ATOMIC_RELAXED);
+
+        // Drain the freshest quote from each feed ring and fold it into
+        // the shared state.  This thread is the only state writer now;
+        // the write lock only fences off GUI control edits and lock-free
+        // readers.
+        ExchangeQuote qa, qb;
+        uint64_t got_a = quote_ring_poll(&g_shared->exa_ring, &qa);
+        uint64_t got_b = quote_ring_poll(&g_shared->exb_ring, &qb);
+        if (got_a || got_b) {
+            pockettrader_write_lock(g_shared);
+            {
+                PocketTraderState *st = &g_shared->state;
+                if (got_a) {
+                    fold_quote(&st->exa, &qa);
+                }
+                if (got_b) {
+                    fold_quote(&st->exb, &qb);
+                }
+            }
+            pockettrader_write_unlock(g_shared);
 
-        if (pthread_mutex_lock(&g_shared->mutex) == 0) {
-            snapshot = g_shared->state;
-            pthread_mutex_unlock(&g_shared->mutex);
+            if (g_ui_wake_fd >= 0 &&
+                t_now - last_ui_wake_ns >= UI_WAKE_INTERVAL_NS) {
+                last_ui_wake_ns = t_now;
+                ui_wake();
+            }
         }
 
+        // Lock-free snapshot of the state this thread just published.
+        PocketTraderState snapshot;
+        pockettrader_read_state(g_shared, &snapshot);
+
         if (!g_running || snapshot.kill_switch || snapshot.circuit_tripped) {
-            sched_yield();
+            strategy_wait_for_update(seen_seq);
             continue;
         }
 
         if (snapshot.strategy_mode == 0) {
-            sched_yield();
+            strategy_wait_for_update(seen_seq);
             continue;
         }
 
@@ -312,58 +1001,44 @@ static void *strategy_thread(void *arg) {
                         (t_now - snapshot.exb.last_update_ns < STALE_THRESHOLD_NS);
 
         if (!exa_fresh || !exb_fresh) {
-            sched_yield();
+            strategy_wait_for_update(seen_seq);
             continue;
         }
 
         double spread_exa_to_exb = snapshot.exb.bid - snapshot.exa.ask;
         double spread_exb_to_exa = snapshot.exa.bid - snapshot.exb.ask;
 
-        int    do_trade    = 0;
-        char   legA_exch[4] = {0};
-        char   legB_exch[4] = {0};
-        char   legA_side[5] = {0};
-        char   legB_side[5] = {0};
-        double legA_price  = 0.0;
-        double legB_price  = 0.0;
-        double used_spread = 0.0;
-
-        if (spread_exa_to_exb >= snapshot.min_spread) {
-            do_trade = 1;
-            strcpy(legA_exch, "EXA");
-            strcpy(legB_exch, "EXB");
-            strcpy(legA_side, "BUY");
-            strcpy(legB_side, "SELL");
-            legA_price  = snapshot.exa.ask;
-            legB_price  = snapshot.exb.bid;
-            used_spread = spread_exa_to_exb;
-        } else if (spread_exb_to_exa >= snapshot.min_spread) {
-            do_trade = 1;
-            strcpy(legA_exch, "EXB");
-            strcpy(legB_exch, "EXA");
-            strcpy(legA_side, "BUY");
-            strcpy(legB_side, "SELL");
-            legA_price  = snapshot.exb.ask;
-            legB_price  = snapshot.exa.bid;
-            used_spread = spread_exb_to_exa;
-        }
+        // Branchless direction pick.  Both spreads are already computed,
+        // so take the larger one and select the legs by index / pointer
+        // select — the compiler turns this into conditional moves instead
+        // of a data-dependent branch that mispredicts every time the
+        // market flips direction.  dir==1 means buy on EXA, sell on EXB.
+        // (Taking the larger spread also means that when both directions
+        // clear min_spread we now trade the better one.)
+        int    dir         = spread_exa_to_exb >= spread_exb_to_exa;
+        double used_spread = dir ? spread_exa_to_exb : spread_exb_to_exa;
+        int    do_trade    = used_spread >= snapshot.min_spread;
+
+        const ExchangeQuote *buy_q  = dir ? &snapshot.exa : &snapshot.exb;
+        const ExchangeQuote *sell_q = dir ? &snapshot.exb : &snapshot.exa;
+
+        double buy_px  = buy_q->ask;
+        double sell_px = sell_q->bid;
 
         if (!do_trade) {
-            if (pthread_mutex_lock(&g_shared->mutex) == 0) {
-                g_shared->state.last_spread_exa_to_exb = spread_exa_to_exb;
-                g_shared->state.last_spread_exb_to_exa = spread_exb_to_exa;
-                pthread_mutex_unlock(&g_shared->mutex);
-            }
-            sched_yield();
+            pockettrader_write_lock(g_shared);
+            g_shared->state.last_spread_exa_to_exb = spread_exa_to_exb;
+            g_shared->state.last_spread_exb_to_exa = spread_exb_to_exa;
+            pockettrader_write_unlock(g_shared);
+            strategy_wait_for_update(seen_seq);
             continue;
         }
 
         if (trades_in_current_second >= MAX_TRADES_PER_SECOND) {
-            if (pthread_mutex_lock(&g_shared->mutex) == 0) {
-                g_shared->state.rate_limited = 1;
-                pthread_mutex_unlock(&g_shared->mutex);
-            }
-            sched_yield();
+            pockettrader_write_lock(g_shared);
+            g_shared->state.rate_limited = 1;
+            pockettrader_write_unlock(g_shared);
+            strategy_wait_for_update(seen_seq);
             continue;
         }
 
@@ -379,13 +1054,16 @@ static void *strategy_thread(void *arg) {
         }
 
         if (!trade_addr_ready_local) {
-            sched_yield();
+            strategy_wait_for_update(seen_seq);
             continue;
         }
 
         trade_addr_local.sin_port = htons(cfg->trade_port);
 
-        uint64_t t_send = now_ns();
+        // now_ns() is read once per iteration at the loop top; the work
+        // between there and here is a couple of memcpys, so t_now is
+        // still accurate to a few hundred ns.
+        uint64_t t_send = t_now;
         uint64_t last_tick_ts =
             (snapshot.exa.last_update_ns > snapshot.exb.last_update_ns)
             ? snapshot.exa.last_update_ns
@@ -393,114 +1071,147 @@ static void *strategy_thread(void *arg) {
         uint64_t tick_to_trade_ns =
             (t_send > last_tick_ts) ? (t_send - last_tick_ts) : 0;
 
-        char msg[256];
-        double pnl = (legB_price - legA_price) * snapshot.trade_size;
-
-        int len = snprintf(msg,
-                           sizeof(msg),
-                           "TRADE ARB1 %s %s %.6f %s %s %.6f %.6f %.6f %llu",
-                           legA_exch,
-                           legA_side,
-                           legA_price,
-                           legB_exch,
-                           legB_side,
-                           legB_price,
-                           snapshot.trade_size,
-                           used_spread,
-                           (unsigned long long)t_send);
-        if (len < 0 || len >= (int)sizeof(msg)) {
+        char *msg = trade_batch_slot(&batch);
+        if (!msg) {
+            strategy_wait_for_update(seen_seq);
+            continue;
+        }
+
+        double pnl = (sell_px - buy_px) * snapshot.trade_size;
+
+        // TRADE ARB1 <exchA> <sideA> <pxA> <exchB> <sideB> <pxB> <size> <spread> <ts>
+        TradeCtx tctx = {
+            .buy_px  = buy_px,
+            .sell_px = sell_px,
+            .size    = snapshot.trade_size,
+            .spread  = used_spread,
+            .ts_ns   = t_send,
+        };
+        int len = g_fmt_trade[dir](msg, &tctx);
+        if (len >= (int)sizeof(batch.bufs[0])) {
             fprintf(stderr, "TRADE message truncated\n");
-            sched_yield();
+            strategy_wait_for_update(seen_seq);
             continue;
         }
+        trade_batch_commit(&batch, len);
 
-        ssize_t sent = sendto(g_trade_sock,
-                              msg,
-                              (size_t)len,
-                              0,
-                              (struct sockaddr *)&trade_addr_local,
-                              sizeof(trade_addr_local));
-        if (sent < 0) {
-            perror("sendto trade");
-            sched_yield();
+        if (trade_batch_flush(&batch, &trade_addr_local) < 0) {
+            perror("send trade");
+            strategy_wait_for_update(seen_seq);
             continue;
         }
 
         trades_in_current_second++;
 
-        if (pthread_mutex_lock(&g_shared->mutex) == 0) {
-            PocketTraderState *st = &g_shared->state;
-            st->last_spread_exa_to_exb = spread_exa_to_exb;
-            st->last_spread_exb_to_exa = spread_exb_to_exa;
-            st->last_trade_ts_ns       = t_send;
-            st->last_tick_to_trade_ns  = tick_to_trade_ns;
-
-            // ----- PnL & performance metrics -----
-            st->last_trade_pnl = pnl;
-            st->cumulative_pnl += pnl;
-            st->trades_count   += 1;
-
-            if (pnl >= 0.0) {
-                st->gross_profit   += pnl;
-                st->winning_trades += 1;
-            } else {
-                st->gross_loss     += -pnl;
-                st->losing_trades  += 1;
-            }
+        // One event per executed trade for the GUI tape, which drains
+        // the ring in order; the published state only carries the last
+        // trade, so without this a burst would show a single row.
+        TradeEvent tev = {
+            .ts_ns  = t_send,
+            .spread = used_spread,
+            .size   = snapshot.trade_size,
+            .pnl    = pnl,
+            .dir    = (uint8_t)dir,
+        };
+        trade_ring_push(&g_shared->trade_ring, &tev);
+
+        // Build the whole writeback from this iteration's snapshot —
+        // this thread owns these fields, so the snapshot values are
+        // current — and keep only the stores inside the lock.
+        TradeDelta delta;
+        delta.last_spread_exa_to_exb = spread_exa_to_exb;
+        delta.last_spread_exb_to_exa = spread_exb_to_exa;
+        delta.last_trade_ts_ns       = t_send;
+        delta.last_tick_to_trade_ns  = tick_to_trade_ns;
+
+        // ----- PnL & performance metrics -----
+        delta.last_trade_pnl = pnl;
+        delta.cumulative_pnl = snapshot.cumulative_pnl + pnl;
+        delta.trades_count   = snapshot.trades_count + 1;
+
+        delta.gross_profit   = snapshot.gross_profit;
+        delta.gross_loss     = snapshot.gross_loss;
+        delta.winning_trades = snapshot.winning_trades;
+        delta.losing_trades  = snapshot.losing_trades;
+        if (pnl >= 0.0) {
+            delta.gross_profit   += pnl;
+            delta.winning_trades += 1;
+        } else {
+            delta.gross_loss     += -pnl;
+            delta.losing_trades  += 1;
+        }
 
-            // Equity curve & max drawdown
-            if (st->trades_count == 1) {
-                st->equity_high  = st->cumulative_pnl;
-                st->max_drawdown = 0.0;
-            } else {
-                if (st->cumulative_pnl > st->equity_high) {
-                    st->equity_high = st->cumulative_pnl;
-                }
-                double dd = st->cumulative_pnl - st->equity_high;
-                if (dd < st->max_drawdown) {
-                    st->max_drawdown = dd;
-                }
-            }
+        // Equity curve & max drawdown
+        if (delta.trades_count == 1) {
+            delta.equity_high  = delta.cumulative_pnl;
+            delta.max_drawdown = 0.0;
+        } else {
+            delta.equity_high  = (delta.cumulative_pnl > snapshot.equity_high)
+                                 ? delta.cumulative_pnl : snapshot.equity_high;
+            double dd = delta.cumulative_pnl - delta.equity_high;
+            delta.max_drawdown = (dd < snapshot.max_drawdown)
+                                 ? dd : snapshot.max_drawdown;
+        }
 
-            // Circuit breaker
-            if (st->cumulative_pnl < P_L_LIMIT) {
-                st->circuit_tripped = 1;
-                st->strategy_mode   = 0;
-            }
+        // Circuit breaker
+        delta.trip_circuit = delta.cumulative_pnl < P_L_LIMIT;
 
-            pthread_mutex_unlock(&g_shared->mutex);
-        }
+        pockettrader_write_lock(g_shared);
+        apply_trade_delta(&g_shared->state, &delta);
+        pockettrader_write_unlock(g_shared);
 
 #if DEBUG_TICKS
         printf("[TRADE] %s/%s size=%.4f buy=%.2f sell=%.2f spread=%.4f pnl=%.4f\n",
-               legA_exch,
-               legB_exch,
+               dir ? "EXA" : "EXB",
+               dir ? "EXB" : "EXA",
                snapshot.trade_size,
-               legA_price,
-               legB_price,
+               buy_px,
+               sell_px,
                used_spread,
                pnl);
         fflush(stdout);
 #endif
 
         // Log: t_now_ns, tick_to_trade_ns, exa_avg_interval_ns, exb_avg_interval_ns
-        if (g_latency_log) {
-            uint64_t t_log = now_ns();
-            fprintf(g_latency_log,
-                    "%llu,%llu,%llu,%llu\n",
-                    (unsigned long long)t_log,
-                    (unsigned long long)tick_to_trade_ns,
-                    (unsigned long long)snapshot.avg_tick_latency_exa_ns,
-                    (unsigned long long)snapshot.avg_tick_latency_exb_ns);
-            fflush(g_latency_log);
+        if (g_latency_fd >= 0) {
+            latency_log_append(t_send,
+                               tick_to_trade_ns,
+                               snapshot.exa.avg_tick_interval_ns,
+                               snapshot.exb.avg_tick_interval_ns);
         }
 
-        sched_yield();
+        strategy_wait_for_update(seen_seq);
     }
 
     return NULL;
 }
 
+// ---------- Thread placement ----------
+
+// Best-effort: pin a thread to an (ideally isolcpus-isolated) core and
+// give it a SCHED_FIFO priority.  Failures are reported but non-fatal so
+// the demo still runs on stock kernels without RT privileges.
+static void set_thread_rt(pthread_t t, const char *name, int cpu, int prio) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(t, sizeof(set), &set) != 0) {
+        fprintf(stderr,
+                "warning: could not pin %s thread to CPU %d: %s\n",
+                name, cpu, strerror(errno));
+    }
+
+    struct sched_param sp;
+    memset(&sp, 0, sizeof(sp));
+    sp.sched_priority = prio;
+    int err = pthread_setschedparam(t, SCHED_FIFO, &sp);
+    if (err != 0) {
+        fprintf(stderr,
+                "warning: could not set SCHED_FIFO prio %d for %s thread: %s\n",
+                prio, name, strerror(err));
+    }
+}
+
 // ---------- Socket helpers ----------
 
 static int create_bound_udp_socket(int port) {
@@ -527,6 +1238,18 @@ static int create_bound_udp_socket(int port) {
         exit(1);
     }
 
+    // Busy-poll the driver for up to 50 us inside the receive syscall
+    // before sleeping: trades sub-100 us wakeup jitter for a little poll
+    // CPU.  Needs CAP_NET_ADMIN on pre-5.0 kernels; failure is harmless,
+    // the socket just falls back to plain interrupt-driven receive.
+#ifdef SO_BUSY_POLL
+    int busy_usec = 50;
+    if (setsockopt(sock, SOL_SOCKET, SO_BUSY_POLL,
+                   &busy_usec, sizeof(busy_usec)) < 0) {
+        perror("setsockopt SO_BUSY_POLL (continuing without busy-poll)");
+    }
+#endif
+
     return sock;
 }
 
@@ -536,6 +1259,10 @@ static void parse_args(int argc, char **argv, CoreConfig *cfg) {
     cfg->exa_port   = DEFAULT_EXA_PORT;
     cfg->exb_port   = DEFAULT_EXB_PORT;
     cfg->trade_port = DEFAULT_TRADE_PORT;
+    cfg->rt_cpu     = -1;
+    cfg->zerocopy   = 0;
+    cfg->ipc_shm    = 0;
+    cfg->trade_host[0] = '\0';
 
     for (int i = 1; i < argc; ++i) {
         if (strcmp(argv[i], "--exa-port") == 0 && i + 1 < argc) {
@@ -544,10 +1271,30 @@ static void parse_args(int argc, char **argv, CoreConfig *cfg) {
             cfg->exb_port = atoi(argv[++i]);
         } else if (strcmp(argv[i], "--trade-port") == 0 && i + 1 < argc) {
             cfg->trade_port = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--rt-cpu") == 0 && i + 1 < argc) {
+            cfg->rt_cpu = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--zerocopy") == 0) {
+            cfg->zerocopy = 1;
+        } else if (strcmp(argv[i], "--ipc=shm") == 0) {
+            cfg->ipc_shm = 1;
+        } else if (strcmp(argv[i], "--trade-host") == 0 && i + 1 < argc) {
+            strncpy(cfg->trade_host, argv[++i], sizeof(cfg->trade_host) - 1);
+            cfg->trade_host[sizeof(cfg->trade_host) - 1] = '\0';
         } else if (strcmp(argv[i], "-h") == 0 ||
                    strcmp(argv[i], "--help") == 0) {
-            printf("Usage: %s [--exa-port N] [--exb-port N] [--trade-port N]\n",
+            printf("Usage: %s [--exa-port N] [--exb-port N] [--trade-port N]"
+                   " [--rt-cpu N] [--zerocopy] [--ipc=shm] [--trade-host IP]\n",
                    argv[0]);
+            printf("  --rt-cpu N      pin feed/strategy threads to CPU N and\n"
+                   "                  run them SCHED_FIFO (pair with isolcpus=N)\n");
+            printf("  --zerocopy      send TRADE messages with MSG_ZEROCOPY\n"
+                   "                  (needs a >= 4.18 kernel; mostly pays off\n"
+                   "                  for large payloads, so measure first)\n");
+            printf("  --ipc=shm       take quotes from the shared-memory rings\n"
+                   "                  (co-located feeder writes them directly);\n"
+                   "                  no UDP feed sockets, requires --trade-host\n");
+            printf("  --trade-host IP send TRADE messages to this address\n"
+                   "                  instead of the first feed's source\n");
             exit(0);
         }
     }
@@ -562,15 +1309,26 @@ int main(int argc, char **argv) {
     signal(SIGINT, handle_signal);
     signal(SIGTERM, handle_signal);
 
+    g_c_numeric_locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+    if (g_c_numeric_locale == (locale_t)0) {
+        perror("newlocale");
+        exit(1);
+    }
+
+    calibrate_now_ns();
+    init_ui_wake_fifo();
+
     init_shared_memory();
 
-    g_latency_log = fopen("latency_log.csv", "w");
-    if (g_latency_log) {
-        fprintf(g_latency_log,
-                "t_now_ns,tick_to_trade_ns,exa_avg_tick_interval_ns,exb_avg_tick_interval_ns\n");
-        fflush(g_latency_log);
+    g_latency_fd = open("latency_log.csv", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (g_latency_fd >= 0) {
+        static const char header[] =
+            "t_now_ns,tick_to_trade_ns,exa_avg_tick_interval_ns,exb_avg_tick_interval_ns\n";
+        if (write(g_latency_fd, header, sizeof(header) - 1) < 0) {
+            perror("write latency_log.csv header");
+        }
     } else {
-        perror("fopen latency_log.csv");
+        perror("open latency_log.csv");
     }
 
     g_trade_sock = socket(AF_INET, SOCK_DGRAM, 0);
@@ -579,49 +1337,151 @@ int main(int argc, char **argv) {
         exit(1);
     }
 
-    int exa_sock = create_bound_udp_socket(cfg.exa_port);
-    int exb_sock = create_bound_udp_socket(cfg.exb_port);
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    int zc_active = 0;
+    if (cfg.zerocopy) {
+        int one = 1;
+        if (setsockopt(g_trade_sock, SOL_SOCKET, SO_ZEROCOPY,
+                       &one, sizeof(one)) == 0) {
+            g_trade_send_flags = MSG_ZEROCOPY;
+            zc_active = 1;
+        } else {
+            perror("setsockopt SO_ZEROCOPY (continuing with copies)");
+        }
+    }
+#else
+    if (cfg.zerocopy) {
+        fprintf(stderr, "MSG_ZEROCOPY not available in this build; "
+                        "continuing with copies\n");
+    }
+#endif
+
+    // TRADE destination: normally learned from the first feed packet's
+    // source address, but in shared-memory feed mode there are no feed
+    // packets, so --trade-host is mandatory there.
+    if (cfg.trade_host[0] != '\0') {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        if (inet_pton(AF_INET, cfg.trade_host, &addr.sin_addr) != 1) {
+            fprintf(stderr, "invalid --trade-host '%s'\n", cfg.trade_host);
+            exit(1);
+        }
+        pthread_mutex_lock(&g_trade_addr_mutex);
+        g_trade_addr       = addr;
+        g_trade_addr_ready = 1;
+        pthread_mutex_unlock(&g_trade_addr_mutex);
+    } else if (cfg.ipc_shm) {
+        fprintf(stderr, "--ipc=shm requires --trade-host\n");
+        exit(1);
+    }
+
+    int exa_sock = -1;
+    int exb_sock = -1;
+
+    if (!cfg.ipc_shm) {
+        exa_sock = create_bound_udp_socket(cfg.exa_port);
+        exb_sock = create_bound_udp_socket(cfg.exb_port);
+
+        // When the hot threads are pinned, steer RX processing for the
+        // feed flows onto the same core so busy-polling hits a warm cache.
+#ifdef SO_INCOMING_CPU
+        if (cfg.rt_cpu >= 0) {
+            if (setsockopt(exa_sock, SOL_SOCKET, SO_INCOMING_CPU,
+                           &cfg.rt_cpu, sizeof(cfg.rt_cpu)) < 0 ||
+                setsockopt(exb_sock, SOL_SOCKET, SO_INCOMING_CPU,
+                           &cfg.rt_cpu, sizeof(cfg.rt_cpu)) < 0) {
+                perror("setsockopt SO_INCOMING_CPU");
+            }
+        }
+#endif
+    }
 
     pthread_t exa_thread;
     pthread_t exb_thread;
     pthread_t strat_thread;
+    pthread_t logger_thread;
 
     FeedThreadArgs exa_args  = { .sock = exa_sock, .is_exa = 1, .config = &cfg };
     FeedThreadArgs exb_args  = { .sock = exb_sock, .is_exa = 0, .config = &cfg };
     StrategyThreadArgs strat_args = { .config = &cfg };
 
-    if (pthread_create(&exa_thread, NULL, feed_receiver_thread, &exa_args) != 0) {
-        perror("pthread_create exa");
+#ifdef POCKETTRADER_IO_URING
+    void *(*feed_fn)(void *) = feed_receiver_thread_uring;
+#else
+    void *(*feed_fn)(void *) = feed_receiver_thread;
+#endif
+
+    // In shared-memory feed mode a co-located producer pushes quotes
+    // straight into exa_ring/exb_ring (same SPSC protocol, plus a
+    // feed_seq bump and futex wake per publish, as the feed threads do);
+    // the strategy thread consumes them identically, so the feed threads
+    // simply are not started.
+    if (!cfg.ipc_shm) {
+        if (pthread_create(&exa_thread, NULL, feed_fn, &exa_args) != 0) {
+            perror("pthread_create exa");
+            exit(1);
+        }
+        if (pthread_create(&exb_thread, NULL, feed_fn, &exb_args) != 0) {
+            perror("pthread_create exb");
+            exit(1);
+        }
+    }
+    if (pthread_create(&strat_thread, NULL, strategy_thread, &strat_args) != 0) {
+        perror("pthread_create strategy");
         exit(1);
     }
-    if (pthread_create(&exb_thread, NULL, feed_receiver_thread, &exb_args) != 0) {
-        perror("pthread_create exb");
+    if (pthread_create(&logger_thread, NULL, latency_logger_thread, NULL) != 0) {
+        perror("pthread_create logger");
         exit(1);
     }
-    if (pthread_create(&strat_thread, NULL, strategy_thread, &strat_args) != 0) {
-        perror("pthread_create strategy");
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    pthread_t zc_thread;
+    if (zc_active &&
+        pthread_create(&zc_thread, NULL, zerocopy_reap_thread, NULL) != 0) {
+        perror("pthread_create zerocopy reap");
         exit(1);
     }
+#endif
+
+    if (cfg.rt_cpu >= 0) {
+        if (!cfg.ipc_shm) {
+            set_thread_rt(exa_thread, "EXA feed", cfg.rt_cpu,
+                          FEED_THREAD_RT_PRIO);
+            set_thread_rt(exb_thread, "EXB feed", cfg.rt_cpu,
+                          FEED_THREAD_RT_PRIO);
+        }
+        set_thread_rt(strat_thread, "strategy", cfg.rt_cpu,
+                      STRATEGY_THREAD_RT_PRIO);
+    }
 
     while (g_running) {
         sleep(1);
     }
 
-    pthread_join(exa_thread, NULL);
-    pthread_join(exb_thread, NULL);
+    if (!cfg.ipc_shm) {
+        pthread_join(exa_thread, NULL);
+        pthread_join(exb_thread, NULL);
+    }
     pthread_join(strat_thread, NULL);
+    pthread_join(logger_thread, NULL);
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    if (zc_active) {
+        pthread_join(zc_thread, NULL);
+    }
+#endif
 
-    close(exa_sock);
-    close(exb_sock);
+    if (exa_sock >= 0) close(exa_sock);
+    if (exb_sock >= 0) close(exb_sock);
     close(g_trade_sock);
 
     if (g_shared) {
         munmap(g_shared, sizeof(*g_shared));
     }
 
-    if (g_latency_log) {
-        fclose(g_latency_log);
-        g_latency_log = NULL;
+    if (g_latency_fd >= 0) {
+        close(g_latency_fd);
+        g_latency_fd = -1;
     }
 
     return 0;
@@ -1,72 +1,343 @@
 #ifndef POCKETTRADER_STATE_H
 #define POCKETTRADER_STATE_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 #include <pthread.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-typedef struct {
+// C/C++ compatible static assert (header is shared by the C core and GUI).
+#ifdef __cplusplus
+#define POCKETTRADER_STATIC_ASSERT(cond, msg) static_assert(cond, msg)
+#else
+#define POCKETTRADER_STATIC_ASSERT(cond, msg) _Static_assert(cond, msg)
+#endif
+
+// Each quote is written by exactly one feed thread; padding it to a full
+// 64-byte cache line keeps the EXA and EXB writers (and the strategy
+// thread's metrics stores) from false-sharing a line.
+typedef struct __attribute__((aligned(64))) {
     double bid;
     double ask;
     uint64_t seq;
     uint64_t last_update_ns;   // BBB receive time
+    // Per-exchange tick-interval metrics live next to the quote they
+    // describe, so one writer's exclusive cache line covers both and
+    // metrics stores never touch a line another exchange's data shares.
+    uint64_t last_tick_interval_ns;
+    uint64_t avg_tick_interval_ns;
     int connected;             // 1 if quote is fresh
 } ExchangeQuote;
 
+POCKETTRADER_STATIC_ASSERT(sizeof(ExchangeQuote) == 64,
+                           "ExchangeQuote must occupy exactly one cache line");
+
 typedef struct {
     // Latest quotes
     ExchangeQuote exa;
     ExchangeQuote exb;
 
-    // Strategy parameters (modifiable by GUI)
-    double min_spread;         // Threshold for trading
-    int strategy_mode;         // 0=OFF,1=MONITOR,2=PAPER
-    int kill_switch;           // 1 = stop trading
-    double trade_size;         // Position size in BTC
-
-    // Metrics
-    double last_spread_exa_to_exb;
-    double last_spread_exb_to_exa;
-    uint64_t last_trade_ts_ns;
-    double cumulative_pnl;
-    uint32_t trades_count;
-
-    // Latency stats (ns)
-    uint64_t last_tick_latency_exa_ns;
-    uint64_t last_tick_latency_exb_ns;
-    uint64_t avg_tick_latency_exa_ns;
-    uint64_t avg_tick_latency_exb_ns;
-
-    // Tick-to-trade latency (ns)
-    uint64_t last_tick_to_trade_ns;
-
-    // Safety flags
-    int circuit_tripped;       // 1 if P&L limit breached
-    int rate_limited;          // 1 if trade skipped due to rate limit
-
-    // -------- Performance metrics --------
-    double last_trade_pnl;     // PnL of the most recent trade
-    double gross_profit;       // Sum of positive trade PnL
-    double gross_loss;         // Sum of absolute value of negative trade PnL
-    uint32_t winning_trades;   // Count of trades with pnl >= 0
-    uint32_t losing_trades;    // Count of trades with pnl < 0
-    double equity_high;        // Running max of cumulative_pnl
-    double max_drawdown;       // Most negative (cumulative_pnl - equity_high)
+    // Strategy parameters (modifiable by GUI).  On their own cache line:
+    // without the split these rarely-written control words share a line
+    // with the strategy thread's per-tick telemetry below, so every GUI
+    // edit would invalidate the hot telemetry line and vice versa.
+    // Anonymous struct keeps field names flat.
+    struct __attribute__((aligned(64))) {
+        double min_spread;         // Threshold for trading
+        double trade_size;         // Position size in BTC
+        int strategy_mode;         // 0=OFF,1=MONITOR,2=PAPER
+        int kill_switch;           // 1 = stop trading
+        int circuit_tripped;       // set by core on P&L breach, cleared by GUI
+    };
+
+    // Per-tick telemetry, written only by the strategy thread.
+    struct __attribute__((aligned(64))) {
+        double last_spread_exa_to_exb;
+        double last_spread_exb_to_exa;
+        uint64_t last_trade_ts_ns;
+        uint64_t last_tick_to_trade_ns;  // Tick-to-trade latency (ns)
+        int rate_limited;          // 1 if trade skipped due to rate limit
+    };
+
+    // -------- PnL & performance metrics --------
+    // Written only by the strategy thread after a trade; grouped on their
+    // own cache line(s) so those stores never invalidate the quote lines
+    // the feed threads own.  Anonymous struct keeps field names flat.
+    struct __attribute__((aligned(64))) {
+        double cumulative_pnl;
+        uint32_t trades_count;
+        double last_trade_pnl;     // PnL of the most recent trade
+        double gross_profit;       // Sum of positive trade PnL
+        double gross_loss;         // Sum of absolute value of negative trade PnL
+        uint32_t winning_trades;   // Count of trades with pnl >= 0
+        uint32_t losing_trades;    // Count of trades with pnl < 0
+        double equity_high;        // Running max of cumulative_pnl
+        double max_drawdown;       // Most negative (cumulative_pnl - equity_high)
+    };
 } PocketTraderState;
 
+// The whole seqlock/snapshot protocol moves the state around with raw
+// memcpy; any C++ (GUI-side) addition of a constructor, destructor or
+// virtual would silently break that, so pin it down.  (In C the struct
+// is trivially copyable by construction.)  The GCC/Clang builtin is
+// used instead of <type_traits> because C++ consumers may include this
+// header inside an extern "C" block, where a template header is a
+// hard error.
+#ifdef __cplusplus
+POCKETTRADER_STATIC_ASSERT(
+    __is_trivially_copyable(PocketTraderState),
+    "PocketTraderState is copied with memcpy and must stay trivially copyable");
+#endif
+
+// The writer-separation story above depends on the blocks actually
+// landing on their own cache lines; a field added in the wrong place
+// re-introduces false sharing without any visible symptom.  Pin the
+// layout: each single-writer block starts on a 64-byte boundary and
+// the struct tiles cleanly in the snapshot ring.
+POCKETTRADER_STATIC_ASSERT(sizeof(PocketTraderState) % 64 == 0,
+                           "state must tile cache lines (snapshot ring slots)");
+POCKETTRADER_STATIC_ASSERT(offsetof(PocketTraderState, min_spread) % 64 == 0,
+                           "GUI-written control block must start a cache line");
+POCKETTRADER_STATIC_ASSERT(
+    offsetof(PocketTraderState, last_spread_exa_to_exb) % 64 == 0,
+    "strategy telemetry block must start a cache line");
+POCKETTRADER_STATIC_ASSERT(offsetof(PocketTraderState, cumulative_pnl) % 64 == 0,
+                           "PnL block must start a cache line");
+
+// Lock-free SPSC quote ring: one producer (a feed thread, or an external
+// same-host feeder writing straight into shared memory), one consumer
+// (the strategy thread).  head and tail live on their own cache lines so
+// producer and consumer never touch the same line; slots become visible
+// through the release-store of head / acquire-load on the consumer side.
+// The producer never blocks — if the consumer lags a full lap, old
+// quotes are simply overwritten, which is the right policy for
+// last-value-wins market data.
+#define POCKETTRADER_QUOTE_RING_SIZE 1024u   // must be a power of two
+
+// Depth of the published-state snapshot ring (power of two).
+#define POCKETTRADER_SNAP_RING_SIZE 8u
+
+typedef struct {
+    uint64_t head __attribute__((aligned(64)));  // next write index (producer-owned)
+    uint64_t tail __attribute__((aligned(64)));  // consumed-up-to index (consumer-owned)
+    ExchangeQuote slots[POCKETTRADER_QUOTE_RING_SIZE] __attribute__((aligned(64)));
+} QuoteRing;
+
+static inline void quote_ring_push(QuoteRing *r, const ExchangeQuote *q)
+{
+    uint64_t h = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+    r->slots[h & (POCKETTRADER_QUOTE_RING_SIZE - 1u)] = *q;
+    __atomic_store_n(&r->head, h + 1, __ATOMIC_RELEASE);
+}
+
+// Copy the newest quote out of the ring and mark everything up to it
+// consumed.  Returns the number of entries consumed (0 = nothing new).
+static inline uint64_t quote_ring_poll(QuoteRing *r, ExchangeQuote *out)
+{
+    uint64_t t = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+    uint64_t h = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    if (h == t) {
+        return 0;
+    }
+    *out = r->slots[(h - 1) & (POCKETTRADER_QUOTE_RING_SIZE - 1u)];
+    __atomic_store_n(&r->tail, h, __ATOMIC_RELEASE);
+    return h - t;
+}
+
+// Per-trade event stream feeding the GUI tape.  SPSC: the strategy
+// thread produces one event per executed trade, the GUI drains them in
+// order — a tape wants every trade, unlike the last-value-wins quote
+// rings.  If the consumer falls a full lap behind, the overwritten span
+// is skipped on the next pop; with this depth against human-rate
+// trades that is a non-event.
+#define POCKETTRADER_TRADE_RING_SIZE 1024u   // must be a power of two
+
+typedef struct {
+    uint64_t ts_ns;    // CLOCK_MONOTONIC at execution
+    double spread;     // spread the trade was taken at
+    double size;
+    double pnl;
+    uint8_t dir;       // 1 = EXA->EXB, 0 = EXB->EXA
+} TradeEvent;
+
+typedef struct {
+    uint64_t head __attribute__((aligned(64)));  // next write index (producer-owned)
+    uint64_t tail __attribute__((aligned(64)));  // next read index (consumer-owned)
+    TradeEvent slots[POCKETTRADER_TRADE_RING_SIZE] __attribute__((aligned(64)));
+} TradeRing;
+
+static inline void trade_ring_push(TradeRing *r, const TradeEvent *e)
+{
+    uint64_t h = __atomic_load_n(&r->head, __ATOMIC_RELAXED);
+    r->slots[h & (POCKETTRADER_TRADE_RING_SIZE - 1u)] = *e;
+    __atomic_store_n(&r->head, h + 1, __ATOMIC_RELEASE);
+}
+
+// Pop the oldest unconsumed event.  Returns 1 with *out filled, 0 if
+// the ring is empty.  A lapped consumer jumps forward over the span
+// the producer overwrote.
+static inline int trade_ring_pop(TradeRing *r, TradeEvent *out)
+{
+    uint64_t t = __atomic_load_n(&r->tail, __ATOMIC_RELAXED);
+    uint64_t h = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    if (h == t) {
+        return 0;
+    }
+    if (h - t > POCKETTRADER_TRADE_RING_SIZE) {
+        t = h - POCKETTRADER_TRADE_RING_SIZE;
+    }
+    *out = r->slots[t & (POCKETTRADER_TRADE_RING_SIZE - 1u)];
+    __atomic_store_n(&r->tail, t + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
 // Shared memory wrapper: mutex + state in one region so GUI and core can share it.
+//
+// Concurrency protocol (seqlock): the core's state writer takes `mutex`
+// and bumps `state_seq` to odd before touching `state`, back to even
+// afterwards.  The GUI writes only the control block and brackets
+// `control_seq` instead — no mutex on that path, since the GUI thread
+// is the control block's sole writer.  Readers never take the mutex;
+// they retry the copy until they observe both sequences even and
+// unchanged.  Each sequence word lives on its own cache line so reader
+// polling does not bounce the line holding the state itself.
 typedef struct {
     uint32_t magic;           // Magic value to signal initialization
-    pthread_mutex_t mutex;    // Process-shared mutex protecting state
-    PocketTraderState state;  // Shared state
+    pthread_mutex_t mutex;    // Process-shared mutex serializing writers
+    uint32_t state_seq __attribute__((aligned(64)));  // Seqlock word (odd = write in progress)
+    uint32_t feed_seq __attribute__((aligned(64)));   // Bumped per ring publish; futex word for waiters
+    // Seqlock word for the control block, owned by the GUI thread (its
+    // only writer).  Control edits bracket this word instead of taking
+    // the mutex, so a spin-box change never enters the kernel and the
+    // core never waits behind the GUI.
+    uint32_t control_seq __attribute__((aligned(64)));
+    PocketTraderState state;  // Canonical state, mutated under the mutex
+    // SPSC snapshot ring for lock-free readers: the state writer mirrors
+    // the canonical state into slot (snap_head & mask) on unlock, then
+    // publishes by bumping `snap_head`.  Readers copy the newest slot
+    // and never contend with the writer, which is always seven publishes
+    // away from reusing it — deep enough that a reader essentially never
+    // retries even if it gets preempted mid-copy.
+    uint32_t snap_head __attribute__((aligned(64)));
+    PocketTraderState state_snap[POCKETTRADER_SNAP_RING_SIZE]
+        __attribute__((aligned(64)));
+    QuoteRing exa_ring;       // EXA feed -> strategy handoff
+    QuoteRing exb_ring;       // EXB feed -> strategy handoff
+    TradeRing trade_ring;     // strategy -> GUI tape, one event per trade
 } PocketTraderShared;
 
 #define POCKETTRADER_SHM_NAME  "/pockettrader_shm"
 #define POCKETTRADER_SHM_MAGIC 0x504b5452u  // 'PKTR'
 
+// Named FIFO the core pokes (one byte, rate-limited) after publishing
+// fresh state, so the GUI can sleep in its event loop instead of
+// polling shared memory on a timer.
+#define POCKETTRADER_UI_WAKE_FIFO "/tmp/pockettrader_uiwake"
+
+// GCC __atomic builtins are used instead of <stdatomic.h> so the same
+// header compiles as C99 (core) and C++ (Qt GUI).
+
+// Field ownership is single-writer throughout: the strategy thread
+// owns quotes, telemetry and PnL; the GUI thread owns the control
+// doubles; the int controls the two sides share are plain atomic
+// stores.  The GUI therefore never takes the mutex — its slots run on
+// one thread, so even GUI-GUI exclusion is structural.  The mutex
+// below serializes only the core's own writers (init vs. strategy
+// thread) and remains the slow-path recovery point.
+
+// Begin a state write: writer-writer exclusion via the mutex, then flag
+// the write to lock-free readers by making the sequence odd.
+static inline void pockettrader_write_lock(PocketTraderShared *shm)
+{
+    pthread_mutex_lock(&shm->mutex);
+    __atomic_store_n(&shm->state_seq, shm->state_seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+// End a state write: publish with an even sequence, mirror the result
+// into the next snapshot ring slot (still under the mutex, so the
+// canonical state is quiescent) and bump the ring head, then release.
+// The mirror copy retries across concurrent mutex-less GUI control
+// edits so a torn double never lands in a snapshot.
+static inline void pockettrader_write_unlock(PocketTraderShared *shm)
+{
+    __atomic_store_n(&shm->state_seq, shm->state_seq + 1, __ATOMIC_RELEASE);
+    uint32_t h = __atomic_load_n(&shm->snap_head, __ATOMIC_RELAXED);
+    uint32_t c1, c2;
+    do {
+        c1 = __atomic_load_n(&shm->control_seq, __ATOMIC_ACQUIRE);
+        memcpy(&shm->state_snap[h & (POCKETTRADER_SNAP_RING_SIZE - 1u)],
+               &shm->state, sizeof(shm->state));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        c2 = __atomic_load_n(&shm->control_seq, __ATOMIC_RELAXED);
+    } while ((c1 & 1u) || c1 != c2);
+    __atomic_store_n(&shm->snap_head, h + 1u, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&shm->mutex);
+}
+
+// Open/close a control-block write from the GUI thread.  The GUI is the
+// only writer of the control doubles, so writer-writer exclusion is
+// structural and a private seqlock word is all the core's whole-state
+// copies need to avoid observing a torn double.  Two relaxed stores and
+// a fence — no mutex, no syscall.  Int control fields (mode, kill
+// switch, circuit flag) do not need the bracket: single aligned-int
+// stores are atomic, and the ones the core also writes are stored with
+// __atomic builtins on both sides instead.
+static inline void pockettrader_control_write_begin(PocketTraderShared *shm)
+{
+    __atomic_store_n(&shm->control_seq, shm->control_seq + 1,
+                     __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static inline void pockettrader_control_write_end(PocketTraderShared *shm)
+{
+    __atomic_store_n(&shm->control_seq, shm->control_seq + 1,
+                     __ATOMIC_RELEASE);
+}
+
+// Lock-free snapshot of the shared state.  Retries while either writer
+// is active — the mutex-holding state writer (state_seq) or the GUI's
+// mutex-less control editor (control_seq); with both write windows
+// being a handful of stores this converges in one or two iterations.
+static inline void pockettrader_read_state(const PocketTraderShared *shm,
+                                           PocketTraderState *out)
+{
+    uint32_t s1, s2, c1, c2;
+    do {
+        s1 = __atomic_load_n(&shm->state_seq, __ATOMIC_ACQUIRE);
+        c1 = __atomic_load_n(&shm->control_seq, __ATOMIC_ACQUIRE);
+        memcpy(out, &shm->state, sizeof(*out));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        s2 = __atomic_load_n(&shm->state_seq, __ATOMIC_RELAXED);
+        c2 = __atomic_load_n(&shm->control_seq, __ATOMIC_RELAXED);
+    } while (((s1 | c1) & 1u) || s1 != s2 || c1 != c2);
+}
+
+// Copy the newest published snapshot out of the ring.  Unlike
+// pockettrader_read_state this never overlaps a write in progress: the
+// writer is filling a slot seven publishes ahead.  The copy is only
+// redone in the (essentially theoretical) case the writer lapped that
+// far mid-copy.
+static inline void pockettrader_read_snapshot(const PocketTraderShared *shm,
+                                              PocketTraderState *out)
+{
+    uint32_t h1, h2;
+    do {
+        h1 = __atomic_load_n(&shm->snap_head, __ATOMIC_ACQUIRE);
+        memcpy(out,
+               &shm->state_snap[(h1 - 1u) &
+                                (POCKETTRADER_SNAP_RING_SIZE - 1u)],
+               sizeof(*out));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        h2 = __atomic_load_n(&shm->snap_head, __ATOMIC_RELAXED);
+    } while (h2 - h1 >= POCKETTRADER_SNAP_RING_SIZE - 1u);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,45 @@
+#ifndef FMTPRICE_H
+#define FMTPRICE_H
+
+#include <cmath>
+#include <cstring>
+
+// Emits v with exactly four fractional digits into out (no NUL) and
+// returns the length.  Prices and spreads are the bulk of what the
+// dashboard formats; scaling to an integer once and peeling digits
+// with divmod skips the generic double-to-string path ("%.4f" walks
+// printf parsing, Grisu-style conversion and locale handling for a
+// fixed, known layout).  Matches "%.4f" output for every value checked
+// against glibc, with one deliberate difference: anything rounding to
+// zero prints as 0.0000, never -0.0000.
+static inline int fmtPrice4(char *out, double v)
+{
+    long long u = llround(v * 10000.0);
+    const bool neg = u < 0;
+    if (neg)
+        u = -u;
+
+    char tmp[24];
+    char *p = tmp + sizeof tmp;
+    for (int i = 0; i < 4; ++i) {
+        *--p = (char)('0' + (int)(u % 10));
+        u /= 10;
+    }
+    *--p = '.';
+    if (u == 0) {
+        *--p = '0';
+    } else {
+        while (u) {
+            *--p = (char)('0' + (int)(u % 10));
+            u /= 10;
+        }
+    }
+    if (neg)
+        *--p = '-';
+
+    const int n = (int)(tmp + sizeof tmp - p);
+    memcpy(out, p, (size_t)n);
+    return n;
+}
+
+#endif // FMTPRICE_H
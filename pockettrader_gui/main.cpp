@@ -1,8 +1,35 @@
 #include <QApplication>
 #include "mainwindow.h"
 
+#include <sched.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+
+// Keep the GUI off the trading core so its polling never evicts the
+// strategy thread's cache lines. The BBB is single-core, so this only
+// kicks in when POCKETTRADER_GUI_CPU names a housekeeping core on a
+// multi-core host; the nice bump always applies. Must run before
+// QApplication spawns any helper threads.
+static void setup_scheduling(void)
+{
+    const char *cpu_env = getenv("POCKETTRADER_GUI_CPU");
+    if (cpu_env) {
+        int cpu = atoi(cpu_env);
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) != 0)
+            perror("sched_setaffinity (gui)");
+    }
+
+    if (setpriority(PRIO_PROCESS, 0, 10) != 0)
+        perror("setpriority (gui)");
+}
+
 int main(int argc, char *argv[])
 {
+    setup_scheduling();
+
     QApplication app(argc, argv);
 
     MainWindow w;
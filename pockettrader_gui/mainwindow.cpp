@@ -1,4 +1,5 @@
 #include "mainwindow.h"
+#include "fmtprice.h"
 
 #include <QApplication>
 #include <QWidget>
@@ -11,35 +12,109 @@
 #include <QResizeEvent>
 #include <QFont>
 #include <QFontMetrics>
+#include <QHash>
+#include <QFile>
 
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/inotify.h>
 #include <fcntl.h>
 #include <unistd.h>
-#include <pthread.h>
 
 #include <cstring>
 #include <algorithm>
-#include <math.h>
 
 #ifndef STALE_THRESHOLD_NS
 #define STALE_THRESHOLD_NS (500000000ULL)  // 0.5 seconds
 #endif
 
+// Refreshing more often than ~60 Hz paints frames nobody can see; FIFO
+// wakeups inside this window are coalesced into one catch-up refresh.
+#define MIN_REFRESH_INTERVAL_NS (16000000ULL)
+
+// The GUI only compares timestamps against the 0.5 s stale threshold,
+// so the coarse clock is plenty: same epoch as CLOCK_MONOTONIC (which
+// the core stamps with), ~1 ms granularity, and served from the vDSO
+// without a full clock read.
 static std::uint64_t now_ns()
 {
     struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
     return (std::uint64_t)ts.tv_sec * 1000000000ULL +
            (std::uint64_t)ts.tv_nsec;
 }
 
+// The coarse clock lags the full-resolution CLOCK_MONOTONIC the core
+// stamps quotes with by up to one jiffy, so a just-updated quote can
+// carry a timestamp ahead of our "now".  Saturate to zero; a plain
+// unsigned subtraction would wrap and mark the freshest feed stale.
+static std::uint64_t quoteAgeNs(std::uint64_t nowNs, std::uint64_t updateNs)
+{
+    return nowNs > updateNs ? nowNs - updateNs : 0;
+}
+
+// FNV-1a over the raw snapshot bytes, used to recognize frames where
+// nothing changed and skip all widget work.  At ~1 KB per frame the
+// hash costs well under a microsecond, versus the label formatting and
+// paint plumbing it short-circuits; no need to vendor a faster hash
+// for that.
+static std::uint64_t fnv1a64(const void *data, size_t len, std::uint64_t h)
+{
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < len; ++i) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static const std::uint64_t kFnvBasis = 14695981039346656037ULL;
+
+// setText only when the bytes actually changed: compare the freshly
+// formatted buffer against the previous one before building any
+// QString, so an unchanged value (the common case) costs a memcmp and
+// no allocation.  `utf8` covers the few strings carrying arrow/µ
+// glyphs.  Identical text would otherwise still cost shaping, layout
+// and a repaint.
+static void setTextBytes(QLabel *label, QByteArray &prev,
+                         const char *buf, int n, bool utf8 = false)
+{
+    if (prev.size() == n && memcmp(prev.constData(), buf, (size_t)n) == 0)
+        return;
+    prev = QByteArray(buf, n);
+    label->setText(utf8 ? QString::fromUtf8(buf, n)
+                        : QString::fromLatin1(buf, n));
+}
+
+// setupUi uses the same handful of font variants (6/7/8/10/14/16 pt,
+// bold or not) on ~30 widgets.  Building each one inline means a fresh
+// QFont copy and font resolution per widget; cache them once instead.
+static const QFont &makeFont(int pt, bool bold)
+{
+    static QHash<int, QFont> cache;
+    const int key = pt * 2 + (bold ? 1 : 0);
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        QFont f(QStringLiteral("DejaVu Sans"), pt);
+        f.setBold(bold);
+        it = cache.insert(key, f);
+    }
+    return it.value();
+}
+
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
+    , m_tickToTradeMedianUs(kLatencyWindow)
 {
     m_shared          = nullptr;
     m_sharedAttached  = false;
     m_timer           = nullptr;
+    m_coalesceTimer   = nullptr;
+    m_lastRefreshNs   = 0;
+    m_wakeFd          = -1;
+    m_wakeNotifier    = nullptr;
+    m_inotifyFd       = -1;
+    m_inotifyNotifier = nullptr;
 
     m_lblStatusExa    = nullptr;
     m_lblStatusExb    = nullptr;
@@ -68,6 +143,7 @@ MainWindow::MainWindow(QWidget *parent)
     m_lblTickToTradeVal   = nullptr;
     m_lblTickToTradeBest  = nullptr;
     m_lblTickToTradeMedian = nullptr;
+    m_lblTickToTradeP95   = nullptr;
 
     m_spinMinSpread   = nullptr;
     m_spinTradeSize   = nullptr;
@@ -75,6 +151,7 @@ MainWindow::MainWindow(QWidget *parent)
     m_btnKillSwitch   = nullptr;
 
     m_tblTrades       = nullptr;
+    m_tapeModel       = nullptr;
 
     m_lblWinRate      = nullptr;
     m_lblProfitFactor = nullptr;
@@ -86,9 +163,23 @@ MainWindow::MainWindow(QWidget *parent)
     m_btnNavLatency   = nullptr;
     m_btnNavTrades    = nullptr;
 
-    m_lastTradesCount    = 0;
-    m_lastCumulativePnl  = 0.0;
+    // ~0u forces the first performance-panel refresh through the gate.
+    m_lastTradesCountPerf  = ~0u;
+    m_lastCumPnlPerf       = 0.0;
+    m_lastMaxDrawdownPerf  = 0.0;
     m_bestTickToTradeUs  = 0.0;
+    m_tickToTradeHead    = 0;
+    m_tickToTradeCount   = 0;
+    m_samplesIngested    = 0;
+    m_samplesSummarized  = 0;
+    m_lastStateHash      = 0;
+
+    m_lastPbLatencyExa  = -1;
+    m_lastPbLatencyExb  = -1;
+    m_lastPbTickToTrade = -1;
+
+    for (int i = 0; i < PageCount; ++i)
+        m_pageDirty[i] = true;
 
     // Global app font: 8 pt, light
     QFont appFont = qApp->font();
@@ -102,15 +193,35 @@ MainWindow::MainWindow(QWidget *parent)
     setFixedSize(480, 272);
 
     attachSharedMemory();
+    if (!m_sharedAttached)
+        watchForCore();
+    openWakeFifo();
 
+    // Normal refreshes are pushed through the wake FIFO; the timer only
+    // covers stale-status redraws and attach/FIFO retries while the core
+    // is down, so one wakeup per second is plenty.
     m_timer = new QTimer(this);
     connect(m_timer, &QTimer::timeout,
             this, &MainWindow::updateFromSharedMemory);
-    m_timer->start(50);   // ~20 FPS polling
+    m_timer->start(1000);
+
+    // Wakeup bursts collapse into one refresh at the next frame
+    // boundary instead of repainting per poke.
+    m_coalesceTimer = new QTimer(this);
+    m_coalesceTimer->setSingleShot(true);
+    m_coalesceTimer->setInterval(16);
+    connect(m_coalesceTimer, &QTimer::timeout,
+            this, &MainWindow::updateFromSharedMemory);
 }
 
 MainWindow::~MainWindow()
 {
+    if (m_wakeFd >= 0) {
+        ::close(m_wakeFd);
+    }
+    if (m_inotifyFd >= 0) {
+        ::close(m_inotifyFd);
+    }
     if (m_sharedAttached && m_shared) {
         munmap(m_shared, sizeof(PocketTraderShared));
     }
@@ -141,37 +252,27 @@ void MainWindow::setupUi()
     statusLayout->setSpacing(6);
 
     // Status labels font: 6 pt
-    QFont fStatusBase;
-    fStatusBase.setFamily("DejaVu Sans");
-    fStatusBase.setPointSize(6);
-    fStatusBase.setBold(false);
-
     m_lblStatusExa = new QLabel("EXA: DISCONNECTED");
-    m_lblStatusExa->setFont(fStatusBase);
+    m_lblStatusExa->setFont(makeFont(6, false));
 
     m_lblStatusExb = new QLabel("EXB: DISCONNECTED");
-    m_lblStatusExb->setFont(fStatusBase);
+    m_lblStatusExb->setFont(makeFont(6, false));
 
     m_lblMode = new QLabel("MODE: UNKNOWN");
-    m_lblMode->setFont(fStatusBase);
+    m_lblMode->setFont(makeFont(6, false));
 
     m_lblTrades = new QLabel("TRADES: 0");
-    m_lblTrades->setFont(fStatusBase);
+    m_lblTrades->setFont(makeFont(6, false));
 
     // PnL: 8 pt
-    QFont fPnl = fStatusBase;
-    fPnl.setPointSize(8);
     m_lblPnl = new QLabel("PnL: 0.00");
-    m_lblPnl->setFont(fPnl);
+    m_lblPnl->setFont(makeFont(8, false));
 
     // Small STOP button: 8 pt bold
     QPushButton *topKill = new QPushButton("STOP");
     topKill->setObjectName("topKillButton");
     topKill->setFixedHeight(18);
-    QFont fTopKill = topKill->font();
-    fTopKill.setPointSize(8);
-    fTopKill.setBold(true);
-    topKill->setFont(fTopKill);
+    topKill->setFont(makeFont(8, true));
 
     statusLayout->addWidget(m_lblStatusExa);
     statusLayout->addWidget(m_lblStatusExb);
@@ -205,12 +306,7 @@ void MainWindow::setupUi()
 
     QLabel *qtTitle = new QLabel("Dual-Exchange Quote Panel");
     qtTitle->setObjectName("sectionTitle");
-    {
-        QFont f = qtTitle->font();
-        f.setPointSize(10);
-        f.setBold(true);
-        qtTitle->setFont(f);
-    }
+    qtTitle->setFont(makeFont(10, true));
     qc->addWidget(qtTitle, 0, Qt::AlignHCenter);
 
     QGridLayout *qGrid = new QGridLayout;
@@ -225,31 +321,16 @@ void MainWindow::setupUi()
 
     QLabel *exaLabel = new QLabel("EXA");
     exaLabel->setObjectName("smallTitle");
-    {
-        QFont f = exaLabel->font();
-        f.setPointSize(8);
-        f.setBold(true);
-        exaLabel->setFont(f);
-    }
+    exaLabel->setFont(makeFont(8, true));
     exaLayout->addWidget(exaLabel, 0, Qt::AlignLeft);
 
     // EXA BID row
     QHBoxLayout *exaBidRow = new QHBoxLayout;
     QLabel *lblExaBidTag = new QLabel("BID");
-    {
-        QFont f = lblExaBidTag->font();
-        f.setPointSize(8);
-        f.setBold(true);
-        lblExaBidTag->setFont(f);
-    }
+    lblExaBidTag->setFont(makeFont(8, true));
     m_lblExaBid = new QLabel("100.0000");
     m_lblExaBid->setObjectName("bigBid");
-    {
-        QFont f = m_lblExaBid->font();
-        f.setPointSize(16);  // auto-scale 10–16
-        f.setBold(true);
-        m_lblExaBid->setFont(f);
-    }
+    m_lblExaBid->setFont(makeFont(16, true)); // auto-scale 10–16
     exaBidRow->addWidget(lblExaBidTag);
     exaBidRow->addStretch();
     exaBidRow->addWidget(m_lblExaBid);
@@ -258,20 +339,10 @@ void MainWindow::setupUi()
     // EXA ASK row (big)
     QHBoxLayout *exaAskRow = new QHBoxLayout;
     QLabel *lblExaAskTag = new QLabel("ASK");
-    {
-        QFont f = lblExaAskTag->font();
-        f.setPointSize(8);
-        f.setBold(true);
-        lblExaAskTag->setFont(f);
-    }
+    lblExaAskTag->setFont(makeFont(8, true));
     m_lblExaAsk = new QLabel("100.0005");
     m_lblExaAsk->setObjectName("bigAsk");
-    {
-        QFont f = m_lblExaAsk->font();
-        f.setPointSize(16);
-        f.setBold(true);
-        m_lblExaAsk->setFont(f);
-    }
+    m_lblExaAsk->setFont(makeFont(16, true));
     exaAskRow->addWidget(lblExaAskTag);
     exaAskRow->addStretch();
     exaAskRow->addWidget(m_lblExaAsk);
@@ -288,33 +359,18 @@ void MainWindow::setupUi()
 
     QLabel *spreadLabel = new QLabel("SPREAD");
     spreadLabel->setObjectName("smallTitle");
-    {
-        QFont f = spreadLabel->font();
-        f.setPointSize(8);
-        f.setBold(true);
-        spreadLabel->setFont(f);
-    }
+    spreadLabel->setFont(makeFont(8, true));
     spreadLayout->addWidget(spreadLabel, 0, Qt::AlignLeft);
 
     m_lblSpreadMain = new QLabel("0.0000");
     m_lblSpreadMain->setObjectName("bigNumberSpread");
-    {
-        QFont f = m_lblSpreadMain->font();
-        f.setPointSize(16); // auto-scale 10–16
-        f.setBold(true);
-        m_lblSpreadMain->setFont(f);
-    }
+    m_lblSpreadMain->setFont(makeFont(16, true)); // auto-scale 10–16
     spreadLayout->addWidget(m_lblSpreadMain, 0, Qt::AlignHCenter);
 
     m_lblSpreadExaToExb = new QLabel("EXA → EXB: 0.0000");
     m_lblSpreadExbToExa = new QLabel("EXB → EXA: 0.0000");
-    {
-        QFont f = m_lblSpreadExaToExb->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_lblSpreadExaToExb->setFont(f);
-        m_lblSpreadExbToExa->setFont(f);
-    }
+    m_lblSpreadExaToExb->setFont(makeFont(8, false));
+    m_lblSpreadExbToExa->setFont(makeFont(8, false));
     spreadLayout->addWidget(m_lblSpreadExaToExb);
     spreadLayout->addWidget(m_lblSpreadExbToExa);
 
@@ -329,31 +385,16 @@ void MainWindow::setupUi()
 
     QLabel *exbLabel = new QLabel("EXB");
     exbLabel->setObjectName("smallTitle");
-    {
-        QFont f = exbLabel->font();
-        f.setPointSize(8);
-        f.setBold(true);
-        exbLabel->setFont(f);
-    }
+    exbLabel->setFont(makeFont(8, true));
     exbLayout->addWidget(exbLabel, 0, Qt::AlignLeft);
 
     // EXB BID row (big)
     QHBoxLayout *exbBidRow = new QHBoxLayout;
     QLabel *lblExbBidTag = new QLabel("BID");
-    {
-        QFont f = lblExbBidTag->font();
-        f.setPointSize(8);
-        f.setBold(true);
-        lblExbBidTag->setFont(f);
-    }
+    lblExbBidTag->setFont(makeFont(8, true));
     m_lblExbBid = new QLabel("99.9995");
     m_lblExbBid->setObjectName("bigBid");
-    {
-        QFont f = m_lblExbBid->font();
-        f.setPointSize(16);
-        f.setBold(true);
-        m_lblExbBid->setFont(f);
-    }
+    m_lblExbBid->setFont(makeFont(16, true));
     exbBidRow->addWidget(lblExbBidTag);
     exbBidRow->addStretch();
     exbBidRow->addWidget(m_lblExbBid);
@@ -362,20 +403,10 @@ void MainWindow::setupUi()
     // EXB ASK row (big)
     QHBoxLayout *exbAskRow = new QHBoxLayout;
     QLabel *lblExbAskTag = new QLabel("ASK");
-    {
-        QFont f = lblExbAskTag->font();
-        f.setPointSize(8);
-        f.setBold(true);
-        lblExbAskTag->setFont(f);
-    }
+    lblExbAskTag->setFont(makeFont(8, true));
     m_lblExbAsk = new QLabel("100.0000");
     m_lblExbAsk->setObjectName("bigAsk");
-    {
-        QFont f = m_lblExbAsk->font();
-        f.setPointSize(16); // auto-scale 10–16
-        f.setBold(true);
-        m_lblExbAsk->setFont(f);
-    }
+    m_lblExbAsk->setFont(makeFont(16, true)); // auto-scale 10–16
     exbAskRow->addWidget(lblExbAskTag);
     exbAskRow->addStretch();
     exbAskRow->addWidget(m_lblExbAsk);
@@ -389,24 +420,14 @@ void MainWindow::setupUi()
     QHBoxLayout *resetRow = new QHBoxLayout;
     m_btnResetCircuit = new QPushButton("Reset Circuit");
     m_btnResetCircuit->setObjectName("resetButton");
-    {
-        QFont f = m_btnResetCircuit->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_btnResetCircuit->setFont(f);
-    }
+    m_btnResetCircuit->setFont(makeFont(8, false));
     resetRow->addStretch();
     resetRow->addWidget(m_btnResetCircuit);
     qc->addLayout(resetRow);
 
     // Min spread label: 8 pt
     m_lblMinSpread = new QLabel("Min spread: 0.0000");
-    {
-        QFont f = m_lblMinSpread->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_lblMinSpread->setFont(f);
-    }
+    m_lblMinSpread->setFont(makeFont(8, false));
     qc->addWidget(m_lblMinSpread);
 
     pq->addWidget(quotesCard, 1);
@@ -429,49 +450,34 @@ void MainWindow::setupUi()
     QGridLayout *ctrlGrid = new QGridLayout;
     ctrlGrid->setSpacing(4);
 
-    QFont fCtrlLabel;
-    fCtrlLabel.setFamily("DejaVu Sans");
-    fCtrlLabel.setPointSize(8);
-    fCtrlLabel.setBold(false);
-
     QLabel *lblMin = new QLabel("Min spread:");
-    lblMin->setFont(fCtrlLabel);
+    lblMin->setFont(makeFont(8, false));
     m_spinMinSpread = new QDoubleSpinBox;
     m_spinMinSpread->setDecimals(4);
     m_spinMinSpread->setRange(0.0, 1000.0);
     m_spinMinSpread->setSingleStep(0.0001);
-    {
-        QFont f = m_spinMinSpread->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_spinMinSpread->setFont(f);
-    }
+    m_spinMinSpread->setFont(makeFont(8, false));
+    // Emit one valueChanged per committed edit (enter/focus-out/step),
+    // not one per keystroke: typing "0.15" otherwise pushes the partial
+    // values 0, 0.1, 0.15 into shared memory as live thresholds.
+    m_spinMinSpread->setKeyboardTracking(false);
 
     QLabel *lblMode = new QLabel("Mode:");
-    lblMode->setFont(fCtrlLabel);
+    lblMode->setFont(makeFont(8, false));
     m_comboMode = new QComboBox;
     m_comboMode->addItem("OFF", 0);
     m_comboMode->addItem("MONITOR", 1);
     m_comboMode->addItem("PAPER", 2);
-    {
-        QFont f = m_comboMode->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_comboMode->setFont(f);
-    }
+    m_comboMode->setFont(makeFont(8, false));
 
     QLabel *lblSize = new QLabel("Trade size:");
-    lblSize->setFont(fCtrlLabel);
+    lblSize->setFont(makeFont(8, false));
     m_spinTradeSize = new QDoubleSpinBox;
     m_spinTradeSize->setDecimals(4);
     m_spinTradeSize->setRange(0.0, 100000.0);
     m_spinTradeSize->setSingleStep(0.001);
-    {
-        QFont f = m_spinTradeSize->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_spinTradeSize->setFont(f);
-    }
+    m_spinTradeSize->setFont(makeFont(8, false));
+    m_spinTradeSize->setKeyboardTracking(false);
 
     ctrlGrid->addWidget(lblMin,          0, 0);
     ctrlGrid->addWidget(m_spinMinSpread, 0, 1);
@@ -487,12 +493,7 @@ void MainWindow::setupUi()
     m_btnKillSwitch = new QPushButton("KILL SWITCH");
     m_btnKillSwitch->setObjectName("killButton");
     m_btnKillSwitch->setMinimumHeight(50);
-    {
-        QFont f = m_btnKillSwitch->font();
-        f.setPointSize(14);
-        f.setBold(true);
-        m_btnKillSwitch->setFont(f);
-    }
+    m_btnKillSwitch->setFont(makeFont(14, true));
     ctrlLayout->addWidget(m_btnKillSwitch, 0, Qt::AlignHCenter);
 
     pcRoot->addWidget(ctrlCard, 1);
@@ -514,22 +515,12 @@ void MainWindow::setupUi()
 
     QLabel *latTitle = new QLabel("Latency");
     latTitle->setObjectName("sectionTitle");
-    {
-        QFont f = latTitle->font();
-        f.setPointSize(10);
-        f.setBold(true);
-        latTitle->setFont(f);
-    }
+    latTitle->setFont(makeFont(10, true));
     latLayout->addWidget(latTitle, 0, Qt::AlignHCenter);
 
     QLabel *feedLabel = new QLabel("Host → BBB feed latency:");
     feedLabel->setObjectName("smallTitle");
-    {
-        QFont f = feedLabel->font();
-        f.setPointSize(8);
-        f.setBold(true);
-        feedLabel->setFont(f);
-    }
+    feedLabel->setFont(makeFont(8, true));
     latLayout->addWidget(feedLabel);
 
     m_pbLatencyExa = new QProgressBar(latCard);
@@ -543,13 +534,8 @@ void MainWindow::setupUi()
 
     m_lblLatencyExaVal = new QLabel("0.00 ms");
     m_lblLatencyExbVal = new QLabel("0.00 ms");
-    {
-        QFont f = m_lblLatencyExaVal->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_lblLatencyExaVal->setFont(f);
-        m_lblLatencyExbVal->setFont(f);
-    }
+    m_lblLatencyExaVal->setFont(makeFont(8, false));
+    m_lblLatencyExbVal->setFont(makeFont(8, false));
 
     QHBoxLayout *exaRow = new QHBoxLayout;
     exaRow->addWidget(m_pbLatencyExa, 1);
@@ -564,12 +550,7 @@ void MainWindow::setupUi()
 
     QLabel *ttLabel = new QLabel("Tick → trade latency:");
     ttLabel->setObjectName("smallTitle");
-    {
-        QFont f = ttLabel->font();
-        f.setPointSize(8);
-        f.setBold(true);
-        ttLabel->setFont(f);
-    }
+    ttLabel->setFont(makeFont(8, true));
     latLayout->addWidget(ttLabel);
 
     m_pbTickToTrade = new QProgressBar(latCard);
@@ -577,12 +558,7 @@ void MainWindow::setupUi()
     m_pbTickToTrade->setTextVisible(false);
     m_pbTickToTrade->setFixedHeight(12);
     m_lblTickToTradeVal = new QLabel("0 µs");
-    {
-        QFont f = m_lblTickToTradeVal->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_lblTickToTradeVal->setFont(f);
-    }
+    m_lblTickToTradeVal->setFont(makeFont(8, false));
 
     QHBoxLayout *ttRow = new QHBoxLayout;
     ttRow->addWidget(m_pbTickToTrade, 1);
@@ -592,15 +568,13 @@ void MainWindow::setupUi()
 
     m_lblTickToTradeBest   = new QLabel("Best: - µs");
     m_lblTickToTradeMedian = new QLabel("Median: - µs");
-    {
-        QFont f = m_lblTickToTradeBest->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_lblTickToTradeBest->setFont(f);
-        m_lblTickToTradeMedian->setFont(f);
-    }
+    m_lblTickToTradeP95    = new QLabel("p95: - µs");
+    m_lblTickToTradeBest->setFont(makeFont(8, false));
+    m_lblTickToTradeMedian->setFont(makeFont(8, false));
+    m_lblTickToTradeP95->setFont(makeFont(8, false));
     latLayout->addWidget(m_lblTickToTradeBest);
     latLayout->addWidget(m_lblTickToTradeMedian);
+    latLayout->addWidget(m_lblTickToTradeP95);
 
     pl->addWidget(latCard, 1);
     m_stack->addWidget(pageLatency); // index 2
@@ -621,12 +595,7 @@ void MainWindow::setupUi()
 
     QLabel *tapeTitle = new QLabel("Trade Tape");
     tapeTitle->setObjectName("sectionTitle");
-    {
-        QFont f = tapeTitle->font();
-        f.setPointSize(10);
-        f.setBold(true);
-        tapeTitle->setFont(f);
-    }
+    tapeTitle->setFont(makeFont(10, true));
     tapeLayout->addWidget(tapeTitle, 0, Qt::AlignHCenter);
 
     // Performance metrics row
@@ -637,14 +606,9 @@ void MainWindow::setupUi()
     m_lblProfitFactor = new QLabel("Profit factor: 0.00");
     m_lblMaxDrawdown  = new QLabel("Max drawdown: 0.00");
 
-    {
-        QFont f = m_lblWinRate->font();
-        f.setPointSize(8);
-        f.setBold(false);
-        m_lblWinRate->setFont(f);
-        m_lblProfitFactor->setFont(f);
-        m_lblMaxDrawdown->setFont(f);
-    }
+    m_lblWinRate->setFont(makeFont(8, false));
+    m_lblProfitFactor->setFont(makeFont(8, false));
+    m_lblMaxDrawdown->setFont(makeFont(8, false));
 
     perfRow->addWidget(m_lblWinRate);
     perfRow->addWidget(m_lblProfitFactor);
@@ -654,27 +618,30 @@ void MainWindow::setupUi()
     tapeLayout->addLayout(perfRow);
 
     // Trade table
-    m_tblTrades = new QTableWidget(0, 5, tapeCard);
-    QStringList headers;
-    headers << "Time" << "Dir" << "Spread" << "Size" << "PnL";
-    m_tblTrades->setHorizontalHeaderLabels(headers);
+    m_tapeModel = new TradeTapeModel(this);
+    m_tblTrades = new QTableView(tapeCard);
+    m_tblTrades->setModel(m_tapeModel);
     m_tblTrades->horizontalHeader()->setStretchLastSection(true);
+    // Fixed sections: recomputing column widths on every row insert is
+    // a layout pass we never need for a constant five-column tape.
+    m_tblTrades->horizontalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    m_tblTrades->setItemDelegate(new TradeTapeDelegate(m_tblTrades));
     m_tblTrades->verticalHeader()->setVisible(false);
+    // Uniform fixed-height rows plus per-pixel scrolling: no per-row
+    // height queries, no whole-row relayout while scrolling.
+    m_tblTrades->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    m_tblTrades->verticalHeader()->setDefaultSectionSize(
+        TradeTapeDelegate::kRowHeight);
+    m_tblTrades->setHorizontalScrollMode(QAbstractItemView::ScrollPerPixel);
+    m_tblTrades->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
     m_tblTrades->setSelectionMode(QAbstractItemView::NoSelection);
     m_tblTrades->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_tblTrades->setAlternatingRowColors(true);
     m_tblTrades->setShowGrid(false);
     m_tblTrades->horizontalHeader()->setDefaultAlignment(Qt::AlignLeft);
 
-    QFont fHeader = m_tblTrades->horizontalHeader()->font();
-    fHeader.setPointSize(8);
-    fHeader.setBold(true);
-    m_tblTrades->horizontalHeader()->setFont(fHeader);
-
-    QFont fRow = m_tblTrades->font();
-    fRow.setPointSize(7);
-    fRow.setBold(false);
-    m_tblTrades->setFont(fRow);
+    m_tblTrades->horizontalHeader()->setFont(makeFont(8, true));
+    m_tblTrades->setFont(makeFont(7, false));
 
     tapeLayout->addWidget(m_tblTrades, 1);
     pt->addWidget(tapeCard, 1);
@@ -689,20 +656,15 @@ void MainWindow::setupUi()
     nav->setContentsMargins(2, 2, 2, 2);
     nav->setSpacing(4);
 
-    QFont fNav;
-    fNav.setFamily("DejaVu Sans");
-    fNav.setPointSize(8);
-    fNav.setBold(true);
-
     m_btnNavQuotes   = new QPushButton("QUOTES");
     m_btnNavControls = new QPushButton("CONTROL");
     m_btnNavLatency  = new QPushButton("LATENCY");
     m_btnNavTrades   = new QPushButton("TAPE");
 
-    m_btnNavQuotes->setFont(fNav);
-    m_btnNavControls->setFont(fNav);
-    m_btnNavLatency->setFont(fNav);
-    m_btnNavTrades->setFont(fNav);
+    m_btnNavQuotes->setFont(makeFont(8, true));
+    m_btnNavControls->setFont(makeFont(8, true));
+    m_btnNavLatency->setFont(makeFont(8, true));
+    m_btnNavTrades->setFont(makeFont(8, true));
 
     nav->addWidget(m_btnNavQuotes);
     nav->addWidget(m_btnNavControls);
@@ -721,6 +683,19 @@ void MainWindow::setupUi()
     connect(m_btnNavTrades, &QPushButton::clicked,
             this, [this]{ m_stack->setCurrentIndex(3); });
 
+    // A page that went stale while hidden catches up as soon as it is
+    // shown rather than waiting for the next core wakeup.
+    connect(m_stack, &QStackedWidget::currentChanged,
+            this, [this](int page) {
+        if (page < 0 || page >= PageCount || !m_pageDirty[page])
+            return;
+        if (!m_sharedAttached)
+            return;
+        PocketTraderState st;
+        pockettrader_read_snapshot(m_shared, &st);
+        refreshPage(page, st);
+    });
+
     // control → slots
     connect(m_spinMinSpread, QOverload<double>::of(&QDoubleSpinBox::valueChanged),
             this, &MainWindow::onMinSpreadChanged);
@@ -739,6 +714,20 @@ void MainWindow::setupUi()
 
     m_stack->setCurrentIndex(0);
 
+    // The dynamic labels only ever show plain text; pinning the format
+    // skips Qt's per-setText rich-text sniffing.
+    const std::initializer_list<QLabel *> plainLabels = {
+        m_lblStatusExa, m_lblStatusExb, m_lblMode, m_lblTrades, m_lblPnl,
+        m_lblExaBid, m_lblExaAsk, m_lblExbBid, m_lblExbAsk,
+        m_lblSpreadMain, m_lblSpreadExaToExb, m_lblSpreadExbToExa,
+        m_lblMinSpread,
+        m_lblLatencyExaVal, m_lblLatencyExbVal, m_lblTickToTradeVal,
+        m_lblTickToTradeBest, m_lblTickToTradeMedian, m_lblTickToTradeP95,
+        m_lblWinRate, m_lblProfitFactor, m_lblMaxDrawdown,
+    };
+    for (QLabel *l : plainLabels)
+        l->setTextFormat(Qt::PlainText);
+
     // initial scaling
     rescaleAllMajorLabels();
 }
@@ -760,26 +749,89 @@ void MainWindow::autoScaleLabel(QLabel *label,
         return;
     }
 
+    // Same text in the same width picks the same point size — skip the
+    // QFontMetrics search (and the redundant setText) entirely.
+    if (label->property("asLastText").toString() == text &&
+        label->property("asLastWidth").toInt() == w) {
+        return;
+    }
+    label->setProperty("asLastText", text);
+    label->setProperty("asLastWidth", w);
+
     QFont base = label->font();
 
-    for (int pt = maxPt; pt >= minPt; --pt) {
+    auto fitsAt = [&](int pt) {
         QFont f = base;
         f.setPointSize(pt);
-        QFontMetrics fm(f);
-        int textWidth = fm.horizontalAdvance(text);
-        if (textWidth <= w - 4) {
-            label->setFont(f);
-            label->setText(text);
-            return;
+        return QFontMetrics(f).horizontalAdvance(text) <= w - 4;
+    };
+
+    // Probe the previously chosen size first: text lengths are stable
+    // frame to frame, so this usually settles in one or two QFontMetrics
+    // constructions instead of a walk over the whole range.
+    int lastPt  = label->property("asLastPt").toInt();
+    int chosen;
+    if (lastPt >= minPt && lastPt <= maxPt && fitsAt(lastPt) &&
+        (lastPt == maxPt || !fitsAt(lastPt + 1))) {
+        chosen = lastPt;
+    } else {
+        // Largest fitting size by binary search; width grows with point
+        // size, so fit is monotonic.  minPt stays the floor even when
+        // nothing fits, matching the old fallback.
+        int lo = minPt;
+        int hi = maxPt;
+        while (lo < hi) {
+            int mid = (lo + hi + 1) / 2;
+            if (fitsAt(mid))
+                lo = mid;
+            else
+                hi = mid - 1;
         }
+        chosen = lo;
     }
+    label->setProperty("asLastPt", chosen);
 
-    QFont f = base;
-    f.setPointSize(minPt);
-    label->setFont(f);
+    if (label->font().pointSize() != chosen) {
+        QFont f = base;
+        f.setPointSize(chosen);
+        label->setFont(f);
+    }
     label->setText(text);
 }
 
+// Change-gated setText for the auto-scaled labels: the font only needs
+// re-probing when the character count changes (the width class), while
+// same-length digit churn repaints at the current point size.
+void MainWindow::setTextScaled(QLabel *label, QString &prev,
+                               const QString &text, int maxPt, int minPt)
+{
+    if (prev == text)
+        return;
+    const bool widthClassChanged = prev.size() != text.size();
+    prev = text;
+    if (widthClassChanged)
+        autoScaleLabel(label, text, maxPt, minPt);
+    else
+        label->setText(text);
+}
+
+// Byte-compare counterpart of setTextScaled (all auto-scaled dynamic
+// strings are plain ASCII).
+void MainWindow::setTextScaledBytes(QLabel *label, QByteArray &prev,
+                                    const char *buf, int n,
+                                    int maxPt, int minPt)
+{
+    if (prev.size() == n && memcmp(prev.constData(), buf, (size_t)n) == 0)
+        return;
+    const bool widthClassChanged = prev.size() != n;
+    prev = QByteArray(buf, n);
+    const QString text = QString::fromLatin1(buf, n);
+    if (widthClassChanged)
+        autoScaleLabel(label, text, maxPt, minPt);
+    else
+        label->setText(text);
+}
+
 void MainWindow::rescaleAllMajorLabels()
 {
     // Big numbers: 10–16 pt
@@ -818,101 +870,13 @@ void MainWindow::resizeEvent(QResizeEvent *event)
 // ----------------------------------------------------------------------
 void MainWindow::applyStyle()
 {
-    QString style = R"(
-        QMainWindow {
-            background-color: #10141a;
-            color: #f0f0f0;
-        }
-        QLabel {
-            color: #f0f0f0;
-        }
-        QLabel#sectionTitle {
-            font-weight: bold;
-        }
-        QLabel#smallTitle {
-            font-weight: bold;
-            letter-spacing: 1px;
-            color: #a0a6b4;
-        }
-        QLabel#bigBid {
-            font-weight: 600;
-            color: #00c0ff;     /* blue for bids */
-        }
-        QLabel#bigAsk {
-            font-weight: 600;
-            color: #ffd45a;     /* yellow for asks */
-        }
-        QLabel#bigNumberSpread {
-            font-weight: 600;
-            color: #1dd1a1;
-        }
-        QFrame#card {
-            background-color: #181d24;
-            border-radius: 10px;
-            border: 1px solid #262c36;
-        }
-        QFrame#subCard {
-            background-color: #151a20;
-            border-radius: 8px;
-            border: 1px solid #262c36;
-        }
-        QFrame#statusFrame {
-            background-color: #151a20;
-            border-radius: 6px;
-            border: 1px solid #262c36;
-        }
-        QPushButton#killButton {
-            background-color: #ff5c5c;
-            border-radius: 10px;
-            border: none;
-            color: white;
-            font-weight: bold;
-            padding: 4px 8px;
-        }
-        QPushButton#killButton:pressed {
-            background-color: #e04848;
-        }
-        QPushButton#resetButton {
-            background-color: transparent;
-            border-radius: 6px;
-            border: 1px solid #ffb84d;
-            color: #ffb84d;
-            padding: 2px 8px;
-        }
-        QProgressBar {
-            background-color: #151a20;
-            border-radius: 4px;
-            border: 1px solid #262c36;
-            text-align: right;
-            padding-right: 4px;
-            color: #f0f0f0;
-        }
-        QProgressBar::chunk {
-            background-color: #00d1b2;
-            border-radius: 4px;
-        }
-        QTableWidget {
-            background-color: #151a20;
-            border-radius: 6px;
-            border: 1px solid #262c36;
-            gridline-color: #262c36;
-            alternate-background-color: #181e26;
-        }
-        QHeaderView::section {
-            background-color: #181d24;
-            color: #a0a6b4;
-            border: none;
-            border-bottom: 1px solid #262c36;
-            padding: 2px 6px;
-        }
-        QDoubleSpinBox, QComboBox {
-            background-color: #151a20;
-            border-radius: 4px;
-            border: 1px solid #262c36;
-            padding: 2px 6px;
-        }
-    )";
-    setStyleSheet(style);
+    // The sheet lives in the binary's resources and is applied to the
+    // application once: a single CSS parse at startup instead of a
+    // re-parse on every window polish.
+    QFile f(QStringLiteral(":/pockettrader.qss"));
+    if (!f.open(QIODevice::ReadOnly))
+        return;
+    qApp->setStyleSheet(QString::fromLatin1(f.readAll()));
 }
 
 // ----------------------------------------------------------------------
@@ -928,21 +892,113 @@ bool MainWindow::attachSharedMemory()
         return false;  // core not up yet
     }
 
+    // MAP_POPULATE pre-faults the whole segment at map time so the
+    // first seqlock snapshot doesn't take a minor fault per 4 KiB page.
+    int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
     void *addr = mmap(nullptr, sizeof(PocketTraderShared),
-                      PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                      PROT_READ | PROT_WRITE, flags, fd, 0);
     ::close(fd);
 
     if (addr == MAP_FAILED) {
         return false;
     }
 
+    // We touch the same few cache lines every poll: readahead buys
+    // nothing, and a page evicted under memory pressure would put a
+    // fault back on the snapshot path. Both hints are best-effort.
+    madvise(addr, sizeof(PocketTraderShared), MADV_RANDOM);
+    mlock(addr, sizeof(PocketTraderShared));
+
     m_shared = static_cast<PocketTraderShared*>(addr);
     m_sharedAttached = true;
+
+    // Core is up; the /dev/shm watch has done its job.
+    if (m_inotifyFd >= 0) {
+        delete m_inotifyNotifier;
+        m_inotifyNotifier = nullptr;
+        ::close(m_inotifyFd);
+        m_inotifyFd = -1;
+    }
     return true;
 }
 
+// While the core is down, don't re-poll shm_open on a timer: watch
+// /dev/shm for creations and try to attach only when something new
+// appears (any create triggers one cheap attach attempt; filtering for
+// the exact name isn't worth parsing the event stream).  The safety
+// timer remains the fallback if inotify isn't available.
+void MainWindow::watchForCore()
+{
+    if (m_sharedAttached || m_inotifyFd >= 0)
+        return;
+
+    m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotifyFd < 0)
+        return;
+    if (inotify_add_watch(m_inotifyFd, "/dev/shm", IN_CREATE) < 0) {
+        ::close(m_inotifyFd);
+        m_inotifyFd = -1;
+        return;
+    }
+
+    m_inotifyNotifier = new QSocketNotifier(m_inotifyFd,
+                                            QSocketNotifier::Read, this);
+    connect(m_inotifyNotifier, &QSocketNotifier::activated, this, [this] {
+        char buf[1024];
+        while (::read(m_inotifyFd, buf, sizeof(buf)) > 0) {
+        }
+        updateFromSharedMemory();  // attaches and disarms on success
+    });
+}
+
+// Edge-triggered refresh: the core writes a byte into a named FIFO
+// (rate-limited on its side) after publishing state, and Qt's event
+// loop wakes us through a QSocketNotifier — zero CPU while the market
+// is quiet, sub-ms refresh latency when it is not.
+void MainWindow::openWakeFifo()
+{
+    if (m_wakeFd >= 0)
+        return;
+
+    m_wakeFd = ::open(POCKETTRADER_UI_WAKE_FIFO, O_RDONLY | O_NONBLOCK);
+    if (m_wakeFd < 0)
+        return;  // core not up yet; the safety timer retries
+
+    m_wakeNotifier = new QSocketNotifier(m_wakeFd,
+                                         QSocketNotifier::Read, this);
+    connect(m_wakeNotifier, &QSocketNotifier::activated, this, [this] {
+        char buf[64];
+        ssize_t n;
+        while ((n = ::read(m_wakeFd, buf, sizeof(buf))) > 0) {
+        }
+        if (n == 0) {
+            // Writer gone (core exited): tear down and let the safety
+            // timer reopen once the core is back, otherwise EOF would
+            // re-trigger the notifier in a busy loop.
+            m_wakeNotifier->deleteLater();
+            m_wakeNotifier = nullptr;
+            ::close(m_wakeFd);
+            m_wakeFd = -1;
+            return;
+        }
+        // The core rate-limits its pokes, but bursts can still land
+        // inside one display frame; fold them into a single scheduled
+        // refresh rather than repainting per poke.
+        if (m_coalesceTimer->isActive())
+            return;
+        if (now_ns() - m_lastRefreshNs < MIN_REFRESH_INTERVAL_NS) {
+            m_coalesceTimer->start();
+            return;
+        }
+        updateFromSharedMemory();
+    });
+}
+
 // ----------------------------------------------------------------------
-// PERIODIC UPDATE
+// REFRESH (FIFO wakeups + 1 Hz safety timer)
 // ----------------------------------------------------------------------
 void MainWindow::updateFromSharedMemory()
 {
@@ -950,27 +1006,66 @@ void MainWindow::updateFromSharedMemory()
         if (!attachSharedMemory())
             return;
     }
+    openWakeFifo();
 
+    // Lock-free copy of the live double-buffered snapshot: the GUI
+    // never takes the shared mutex and never overlaps a writer, which
+    // is always filling the other slot.
     PocketTraderState st;
-    std::memset(&st, 0, sizeof(st));
-
-    if (pthread_mutex_lock(&m_shared->mutex) == 0) {
-        st = m_shared->state;  // copy only, no UI work under the lock
-        pthread_mutex_unlock(&m_shared->mutex);
-    } else {
-        return;
-    }
+    pockettrader_read_snapshot(m_shared, &st);
 
     std::uint64_t now = now_ns();
+    m_lastRefreshNs = now;
 
-    updateStatusBar(st, now);
-    updateQuotePanel(st);
-    updateLatencyPanel(st);
-    updateControlPanel(st);
+    // Drain trade events ahead of the frame-skip gate: a backlog left
+    // by the per-frame drain bound must still empty on safety-timer
+    // frames whose state hashes unchanged.  Costs two atomic loads
+    // when the ring is empty.
     updateTradeTape(st);
-    updatePerformancePanel(st);
 
-    rescaleAllMajorLabels();
+    // Most wakeups deliver a state identical to the last one (quiet
+    // feed, safety-timer tick).  Hash the snapshot together with the
+    // derived staleness codes — those can flip with no state change as
+    // quotes age past the threshold — and skip the whole frame when
+    // nothing the UI shows could have moved.
+    unsigned char staleCodes =
+        (unsigned char)((st.exa.connected &&
+                         quoteAgeNs(now, st.exa.last_update_ns)
+                             <= STALE_THRESHOLD_NS)
+                        | ((st.exb.connected &&
+                            quoteAgeNs(now, st.exb.last_update_ns)
+                                <= STALE_THRESHOLD_NS)
+                           << 1));
+    std::uint64_t h = fnv1a64(&st, sizeof st, kFnvBasis);
+    h = fnv1a64(&staleCodes, sizeof staleCodes, h);
+    if (h == m_lastStateHash)
+        return;
+    m_lastStateHash = h;
+
+    // The status bar is always visible, and latency samples must keep
+    // ingesting regardless of which page is shown.
+    updateStatusBar(st, now);
+    ingestLatencySample(st);
+
+    // Hidden pages are never repainted, so formatting text for them is
+    // pure waste; mark them stale and refresh only the visible one.
+    // Page switches catch up via the currentChanged handler.
+    for (int i = 0; i < PageCount; ++i)
+        m_pageDirty[i] = true;
+
+    refreshPage(m_stack->currentIndex(), st);
+}
+
+void MainWindow::refreshPage(int page, const PocketTraderState &st)
+{
+    switch (page) {
+    case PageQuotes:  updateQuotePanel(st);       break;
+    case PageControl: updateControlPanel(st);     break;
+    case PageLatency: updateLatencyPanel(st);     break;
+    case PageTape:    updatePerformancePanel(st); break;
+    default:          return;
+    }
+    m_pageDirty[page] = false;
 }
 
 // ----------------------------------------------------------------------
@@ -979,114 +1074,225 @@ void MainWindow::updateFromSharedMemory()
 void MainWindow::updateStatusBar(const PocketTraderState &st,
                                  std::uint64_t nowNs)
 {
-    auto fmtStatus = [nowNs](const ExchangeQuote &q) -> QString {
-        if (!q.connected)
-            return "DISCONNECTED";
-        std::uint64_t ageNs = nowNs - q.last_update_ns;
-        if (ageNs > STALE_THRESHOLD_NS)
-            return "STALE";
-        return "CONNECTED";
+    // Feed status only ever takes three values, so the final strings
+    // are baked as zero-alloc QStringLiteral tables and selected by
+    // index — no per-tick formatting at all.
+    static const QString kExaStatus[3] = {
+        QStringLiteral("EXA: DISCONNECTED"),
+        QStringLiteral("EXA: STALE"),
+        QStringLiteral("EXA: CONNECTED"),
+    };
+    static const QString kExbStatus[3] = {
+        QStringLiteral("EXB: DISCONNECTED"),
+        QStringLiteral("EXB: STALE"),
+        QStringLiteral("EXB: CONNECTED"),
     };
 
-    QString exaStatus = fmtStatus(st.exa);
-    QString exbStatus = fmtStatus(st.exb);
+    auto statusIdx = [nowNs](const ExchangeQuote &q) -> int {
+        if (!q.connected)
+            return 0;
+        return (quoteAgeNs(nowNs, q.last_update_ns) > STALE_THRESHOLD_NS)
+                   ? 1 : 2;
+    };
 
-    m_lblStatusExa->setText(QString("EXA: %1").arg(exaStatus));
-    m_lblStatusExb->setText(QString("EXB: %1").arg(exbStatus));
+    setTextScaled(m_lblStatusExa, m_prevStatusExa,
+                  kExaStatus[statusIdx(st.exa)], 8, 6);
+    setTextScaled(m_lblStatusExb, m_prevStatusExb,
+                  kExbStatus[statusIdx(st.exb)], 8, 6);
+
+    // qsnprintf into a stack buffer: QString::arg parses the format,
+    // consults the locale and allocates per call — all for constant
+    // tags in front of a short value.
+    char buf[48];
+    int n;
+
+    // Indexed table instead of a switch; the unsigned cast folds the
+    // negative and too-large cases into one bound check that clamps to
+    // the UNKNOWN entry.
+    static const char *const kModeStr[4] = {
+        "OFF", "MONITOR", "PAPER", "UNKNOWN"
+    };
+    const unsigned modeIdx =
+        std::min((unsigned)st.strategy_mode, 3u);
 
-    QString modeStr = "UNKNOWN";
-    switch (st.strategy_mode) {
-    case 0: modeStr = "OFF";      break;
-    case 1: modeStr = "MONITOR";  break;
-    case 2: modeStr = "PAPER";    break;
-    }
+    n = qsnprintf(buf, sizeof buf, "MODE: %s%s", kModeStr[modeIdx],
+                  st.circuit_tripped ? " (CIRCUIT)" : "");
+    setTextScaledBytes(m_lblMode, m_prevText[TxtMode], buf, n, 8, 6);
 
-    if (st.circuit_tripped) {
-        modeStr += " (CIRCUIT)";
-    }
+    n = qsnprintf(buf, sizeof buf, "TRADES: %u", st.trades_count);
+    setTextScaledBytes(m_lblTrades, m_prevText[TxtTrades], buf, n, 8, 6);
 
-    m_lblMode->setText(QString("MODE: %1").arg(modeStr));
-    m_lblTrades->setText(QString("TRADES: %1").arg(st.trades_count));
-    m_lblPnl->setText(QString("PnL: %1").arg(st.cumulative_pnl, 0, 'f', 2));
+    n = qsnprintf(buf, sizeof buf, "PnL: %.2f", st.cumulative_pnl);
+    setTextScaledBytes(m_lblPnl, m_prevText[TxtPnl], buf, n, 8, 6);
 }
 
 void MainWindow::updateQuotePanel(const PocketTraderState &st)
 {
-    // EXA / EXB bid/ask
-    m_lblExaBid->setText(QString::number(st.exa.bid, 'f', 4));
-    m_lblExaAsk->setText(QString::number(st.exa.ask, 'f', 4));
-    m_lblExbBid->setText(QString::number(st.exb.bid, 'f', 4));
-    m_lblExbAsk->setText(QString::number(st.exb.ask, 'f', 4));
+    char buf[48];
+    int n;
+
+    // EXA / EXB bid/ask: fixed four-decimal layout, so the integer
+    // divmod formatter replaces the generic printf float path.
+    n = fmtPrice4(buf, st.exa.bid);
+    setTextScaledBytes(m_lblExaBid, m_prevText[TxtExaBid], buf, n, 16, 10);
+    n = fmtPrice4(buf, st.exa.ask);
+    setTextScaledBytes(m_lblExaAsk, m_prevText[TxtExaAsk], buf, n, 16, 10);
+    n = fmtPrice4(buf, st.exb.bid);
+    setTextScaledBytes(m_lblExbBid, m_prevText[TxtExbBid], buf, n, 16, 10);
+    n = fmtPrice4(buf, st.exb.ask);
+    setTextScaledBytes(m_lblExbAsk, m_prevText[TxtExbAsk], buf, n, 16, 10);
 
     // spreads from state
     double s1 = st.last_spread_exa_to_exb;
     double s2 = st.last_spread_exb_to_exa;
     double mainSpread = std::max(s1, s2);
 
-    m_lblSpreadMain->setText(QString::number(mainSpread, 'f', 4));
-    m_lblSpreadExaToExb->setText(
-                QString("EXA → EXB: %1").arg(s1, 0, 'f', 4));
-    m_lblSpreadExbToExa->setText(
-                QString("EXB → EXA: %1").arg(s2, 0, 'f', 4));
+    n = fmtPrice4(buf, mainSpread);
+    setTextScaledBytes(m_lblSpreadMain, m_prevText[TxtSpreadMain], buf, n, 16, 10);
+    // Prefixed spreads: copy the constant tag, append the divmod-
+    // formatted value.  "→" is not Latin-1; these two go through
+    // fromUtf8.
+    n = (int)sizeof("EXA → EXB: ") - 1;
+    memcpy(buf, "EXA → EXB: ", (size_t)n);
+    n += fmtPrice4(buf + n, s1);
+    setTextBytes(m_lblSpreadExaToExb, m_prevText[TxtSpreadExaToExb], buf, n, true);
+    n = (int)sizeof("EXB → EXA: ") - 1;
+    memcpy(buf, "EXB → EXA: ", (size_t)n);
+    n += fmtPrice4(buf + n, s2);
+    setTextBytes(m_lblSpreadExbToExa, m_prevText[TxtSpreadExbToExa], buf, n, true);
+
+    n = (int)sizeof("Min spread: ") - 1;
+    memcpy(buf, "Min spread: ", (size_t)n);
+    n += fmtPrice4(buf + n, st.min_spread);
+    setTextBytes(m_lblMinSpread, m_prevText[TxtMinSpread], buf, n);
+}
 
-    m_lblMinSpread->setText(
-                QString("Min spread: %1").arg(st.min_spread, 0, 'f', 4));
+void MainWindow::ingestLatencySample(const PocketTraderState &st)
+{
+    double ttUs = st.last_tick_to_trade_ns / 1000.0;
+    if (ttUs <= 0.0)
+        return;
+
+    if (m_bestTickToTradeUs == 0.0 || ttUs < m_bestTickToTradeUs)
+        m_bestTickToTradeUs = ttUs;
+
+    m_tickToTradeSamplesUs[(m_tickToTradeHead + m_tickToTradeCount) %
+                           kLatencyWindow] = ttUs;
+    if (m_tickToTradeCount < kLatencyWindow)
+        ++m_tickToTradeCount;
+    else
+        m_tickToTradeHead = (m_tickToTradeHead + 1) % kLatencyWindow;
+    m_tickToTradeMedianUs.add(ttUs);
+    ++m_samplesIngested;
 }
 
 void MainWindow::updateLatencyPanel(const PocketTraderState &st)
 {
-    double exaMs = st.avg_tick_latency_exa_ns / 1e6;
-    double exbMs = st.avg_tick_latency_exb_ns / 1e6;
-
-    int exaUs = (int)std::min(9999.0,
-                              st.avg_tick_latency_exa_ns / 1000.0);
-    int exbUs = (int)std::min(9999.0,
-                              st.avg_tick_latency_exb_ns / 1000.0);
+    double exaMs = st.exa.avg_tick_interval_ns / 1e6;
+    double exbMs = st.exb.avg_tick_interval_ns / 1e6;
+
+    // Clamp here and skip unchanged values: QProgressBar::setValue
+    // re-clamps, emits valueChanged, restyles and repaints every call.
+    // Integer divide and clamp — the values are integral nanoseconds,
+    // so there is nothing for floating point to add.
+    int exaUs = (int)std::min<std::uint64_t>(
+        st.exa.avg_tick_interval_ns / 1000u, 9999u);
+    int exbUs = (int)std::min<std::uint64_t>(
+        st.exb.avg_tick_interval_ns / 1000u, 9999u);
+
+    if (exaUs != m_lastPbLatencyExa) {
+        m_lastPbLatencyExa = exaUs;
+        m_pbLatencyExa->setValue(exaUs);
+    }
+    if (exbUs != m_lastPbLatencyExb) {
+        m_lastPbLatencyExb = exbUs;
+        m_pbLatencyExb->setValue(exbUs);
+    }
 
-    m_pbLatencyExa->setValue(exaUs);
-    m_pbLatencyExb->setValue(exbUs);
+    char buf[48];
+    int n;
 
-    m_lblLatencyExaVal->setText(QString::number(exaMs, 'f', 2) + " ms");
-    m_lblLatencyExbVal->setText(QString::number(exbMs, 'f', 2) + " ms");
+    n = qsnprintf(buf, sizeof buf, "%.2f ms", exaMs);
+    setTextBytes(m_lblLatencyExaVal, m_prevText[TxtLatencyExaVal], buf, n);
+    n = qsnprintf(buf, sizeof buf, "%.2f ms", exbMs);
+    setTextBytes(m_lblLatencyExbVal, m_prevText[TxtLatencyExbVal], buf, n);
 
     double ttUs = st.last_tick_to_trade_ns / 1000.0;
-    int ttUsInt = (int)std::min(2000.0, ttUs);
-
-    m_pbTickToTrade->setValue(ttUsInt);
-    m_lblTickToTradeVal->setText(QString::number(ttUs, 'f', 0) + " µs");
+    int ttUsInt = (int)std::min<std::uint64_t>(
+        st.last_tick_to_trade_ns / 1000u, 2000u);
 
-    if (ttUs > 0.0) {
-        if (m_bestTickToTradeUs == 0.0 || ttUs < m_bestTickToTradeUs)
-            m_bestTickToTradeUs = ttUs;
-
-        m_tickToTradeSamplesUs.append(ttUs);
-        if (m_tickToTradeSamplesUs.size() > 200)
-            m_tickToTradeSamplesUs.removeFirst();
-
-        m_lblTickToTradeBest->setText(
-                    QString("Best so far: %1 µs")
-                    .arg(m_bestTickToTradeUs, 0, 'f', 0));
-
-        QList<double> copy = m_tickToTradeSamplesUs;
-        std::sort(copy.begin(), copy.end());
-        double median = copy[copy.size()/2];
-        m_lblTickToTradeMedian->setText(
-                    QString("Median: %1 µs").arg(median, 0, 'f', 0));
+    if (ttUsInt != m_lastPbTickToTrade) {
+        m_lastPbTickToTrade = ttUsInt;
+        m_pbTickToTrade->setValue(ttUsInt);
+    }
+    n = qsnprintf(buf, sizeof buf, "%.0f µs", ttUs);
+    setTextBytes(m_lblTickToTradeVal, m_prevText[TxtTickToTradeVal], buf, n, true);
+
+    if (m_tickToTradeCount > 0) {
+        n = qsnprintf(buf, sizeof buf, "Best so far: %.0f µs",
+                      m_bestTickToTradeUs);
+        setTextBytes(m_lblTickToTradeBest, m_prevText[TxtTickToTradeBest], buf, n,
+                     true);
+
+        double median = m_tickToTradeMedianUs.median();
+        n = qsnprintf(buf, sizeof buf, "Median: %.0f µs", median);
+        setTextBytes(m_lblTickToTradeMedian, m_prevText[TxtTickToTradeMedian], buf, n,
+                     true);
+
+        // p95 and worst over the raw window, recomputed only when a
+        // sample actually arrived.  Scalar on purpose: the BBB's NEON
+        // has no double-precision lanes, and a once-per-trade
+        // nth_element over 200 doubles is noise next to the paint work
+        // it sits beside.  Ring order is irrelevant to an order
+        // statistic, so the occupied prefix is passed as is.
+        if (m_samplesSummarized != m_samplesIngested) {
+            m_samplesSummarized = m_samplesIngested;
+
+            std::array<double, kLatencyWindow> local;
+            const int cnt = m_tickToTradeCount;
+            memcpy(local.data(), m_tickToTradeSamplesUs.data(),
+                   (size_t)cnt * sizeof(double));
+
+            double worst = local[0];
+            for (int i = 1; i < cnt; ++i)
+                worst = std::max(worst, local[i]);
+
+            const int k = (95 * (cnt - 1)) / 100;
+            std::nth_element(local.begin(), local.begin() + k,
+                             local.begin() + cnt);
+
+            n = qsnprintf(buf, sizeof buf, "p95: %.0f µs  (worst %.0f µs)",
+                          local[k], worst);
+            setTextBytes(m_lblTickToTradeP95, m_prevText[TxtTickToTradeP95],
+                         buf, n, true);
+        }
     }
 }
 
 void MainWindow::updateControlPanel(const PocketTraderState &st)
 {
+    Q_UNUSED(st);
+
+    // Read controls from the canonical state, not the snapshot: mutex-
+    // less control edits only reach the snapshots on the core's next
+    // publish, and a quiet feed would revert the widgets to stale
+    // values.  The doubles are owned by this very thread; the mode has
+    // a second (core) writer and is loaded atomically.
+    double minSpread = m_shared->state.min_spread;
+    double tradeSize = m_shared->state.trade_size;
+    int    mode      = __atomic_load_n(&m_shared->state.strategy_mode,
+                                       __ATOMIC_ACQUIRE);
+
     bool old1 = m_spinMinSpread->blockSignals(true);
     bool old2 = m_spinTradeSize->blockSignals(true);
     bool old3 = m_comboMode->blockSignals(true);
 
-    m_spinMinSpread->setValue(st.min_spread);
-    m_spinTradeSize->setValue(st.trade_size);
+    m_spinMinSpread->setValue(minSpread);
+    m_spinTradeSize->setValue(tradeSize);
 
     int modeIdx = 0;
-    if (st.strategy_mode == 1) modeIdx = 1;
-    else if (st.strategy_mode == 2) modeIdx = 2;
+    if (mode == 1) modeIdx = 1;
+    else if (mode == 2) modeIdx = 2;
     m_comboMode->setCurrentIndex(modeIdx);
 
     m_spinMinSpread->blockSignals(old1);
@@ -1096,43 +1302,39 @@ void MainWindow::updateControlPanel(const PocketTraderState &st)
 
 void MainWindow::updateTradeTape(const PocketTraderState &st)
 {
-    if (!m_tblTrades)
-        return;
+    Q_UNUSED(st);
 
-    if (st.trades_count <= m_lastTradesCount)
+    if (!m_tblTrades)
         return;
 
-    // Only log one row per update: last trade
-    QString dir;
-    double usedSpread;
-    if (st.last_spread_exa_to_exb >= st.last_spread_exb_to_exa) {
-        dir = "EXA→EXB";
-        usedSpread = st.last_spread_exa_to_exb;
-    } else {
-        dir = "EXB→EXA";
-        usedSpread = st.last_spread_exb_to_exa;
+    // Drain the per-trade event ring — the published state only
+    // carries the last trade, so reading it meant a burst between two
+    // frames showed one row.  Bounded per frame so a huge backlog
+    // cannot stall the event loop; the rest drains next frame.
+    // Repaints are held across the batch, but the hold is only opened
+    // once the first event actually pops: re-enabling updates schedules
+    // a repaint of the view unconditionally, and this runs on every
+    // refresh — bracketing an empty drain would repaint the tape at
+    // wake rate on pure quote motion.
+    const int kMaxDrainPerFrame = 20;
+
+    TradeEvent ev;
+    int drained = 0;
+    while (drained < kMaxDrainPerFrame &&
+           trade_ring_pop(&m_shared->trade_ring, &ev)) {
+        if (drained == 0)
+            m_tblTrades->setUpdatesEnabled(false);
+        TradeRow row;
+        row.timeMs = QTime::currentTime().msecsSinceStartOfDay();
+        row.dir    = ev.dir;
+        row.spread = (float)ev.spread;
+        row.size   = (float)ev.size;
+        row.pnl    = (float)ev.pnl;
+        m_tapeModel->appendTrade(row);
+        ++drained;
     }
-
-    int row = m_tblTrades->rowCount();
-    m_tblTrades->insertRow(row);
-
-    m_tblTrades->setItem(row, 0,
-        new QTableWidgetItem(QTime::currentTime().toString("HH:mm:ss")));
-    m_tblTrades->setItem(row, 1,
-        new QTableWidgetItem(dir));
-    m_tblTrades->setItem(row, 2,
-        new QTableWidgetItem(QString::number(usedSpread, 'f', 4)));
-    m_tblTrades->setItem(row, 3,
-        new QTableWidgetItem(QString::number(st.trade_size, 'f', 4)));
-    m_tblTrades->setItem(row, 4,
-        new QTableWidgetItem(QString::number(st.last_trade_pnl, 'f', 4)));
-
-    while (m_tblTrades->rowCount() > 50) {
-        m_tblTrades->removeRow(0);
-    }
-
-    m_lastTradesCount   = st.trades_count;
-    m_lastCumulativePnl = st.cumulative_pnl;
+    if (drained > 0)
+        m_tblTrades->setUpdatesEnabled(true);
 }
 
 void MainWindow::updatePerformancePanel(const PocketTraderState &st)
@@ -1140,30 +1342,43 @@ void MainWindow::updatePerformancePanel(const PocketTraderState &st)
     if (!m_lblWinRate || !m_lblProfitFactor || !m_lblMaxDrawdown)
         return;
 
+    // Everything below derives from the trade statistics; while no
+    // trade has landed (the common frame, since quote motion alone
+    // keeps frames coming) there is nothing to reformat.
+    if (st.trades_count == m_lastTradesCountPerf &&
+        st.cumulative_pnl == m_lastCumPnlPerf &&
+        st.max_drawdown == m_lastMaxDrawdownPerf)
+        return;
+    m_lastTradesCountPerf = st.trades_count;
+    m_lastCumPnlPerf      = st.cumulative_pnl;
+    m_lastMaxDrawdownPerf = st.max_drawdown;
+
     double winRate = 0.0;
     if (st.trades_count > 0) {
         winRate = 100.0 * (double)st.winning_trades /
                   (double)st.trades_count;
     }
 
-    QString pfText;
+    char buf[48];
+    int n;
+
     if (st.gross_loss > 0.0) {
         double profitFactor = st.gross_profit / st.gross_loss;
-        pfText = QString("Profit factor: %1").arg(profitFactor, 0, 'f', 2);
+        n = qsnprintf(buf, sizeof buf, "Profit factor: %.2f", profitFactor);
     } else if (st.gross_profit > 0.0) {
-        pfText = QString("Profit factor: N/A");
+        n = qsnprintf(buf, sizeof buf, "Profit factor: N/A");
     } else {
-        pfText = QString("Profit factor: 0.00");
+        n = qsnprintf(buf, sizeof buf, "Profit factor: 0.00");
     }
+    setTextBytes(m_lblProfitFactor, m_prevText[TxtProfitFactor], buf, n);
 
     double maxDDAbs = -st.max_drawdown;
     if (maxDDAbs < 0.0) maxDDAbs = 0.0;
 
-    m_lblWinRate->setText(
-        QString("Win rate: %1 %").arg(winRate, 0, 'f', 1));
-    m_lblProfitFactor->setText(pfText);
-    m_lblMaxDrawdown->setText(
-        QString("Max drawdown: %1").arg(maxDDAbs, 0, 'f', 2));
+    n = qsnprintf(buf, sizeof buf, "Win rate: %.1f %%", winRate);
+    setTextBytes(m_lblWinRate, m_prevText[TxtWinRate], buf, n);
+    n = qsnprintf(buf, sizeof buf, "Max drawdown: %.2f", maxDDAbs);
+    setTextBytes(m_lblMaxDrawdown, m_prevText[TxtMaxDrawdown], buf, n);
 }
 
 // ----------------------------------------------------------------------
@@ -1172,48 +1387,43 @@ void MainWindow::updatePerformancePanel(const PocketTraderState &st)
 void MainWindow::onMinSpreadChanged(double value)
 {
     if (!m_sharedAttached) return;
-    if (pthread_mutex_lock(&m_shared->mutex) == 0) {
-        m_shared->state.min_spread = value;
-        pthread_mutex_unlock(&m_shared->mutex);
-    }
+    // This thread is the only writer of the control doubles; the seqlock
+    // bracket keeps the core's whole-state copies from seeing a torn
+    // value.  No mutex and no syscall on the edit path.
+    pockettrader_control_write_begin(m_shared);
+    m_shared->state.min_spread = value;
+    pockettrader_control_write_end(m_shared);
 }
 
 void MainWindow::onTradeSizeChanged(double value)
 {
     if (!m_sharedAttached) return;
-    if (pthread_mutex_lock(&m_shared->mutex) == 0) {
-        m_shared->state.trade_size = value;
-        pthread_mutex_unlock(&m_shared->mutex);
-    }
+    pockettrader_control_write_begin(m_shared);
+    m_shared->state.trade_size = value;
+    pockettrader_control_write_end(m_shared);
 }
 
 void MainWindow::onModeChanged(int index)
 {
     if (!m_sharedAttached) return;
     int mode = m_comboMode->itemData(index).toInt();
-    if (pthread_mutex_lock(&m_shared->mutex) == 0) {
-        m_shared->state.strategy_mode = mode;
-        pthread_mutex_unlock(&m_shared->mutex);
-    }
+    // Single aligned-int store; atomic because the core also writes the
+    // mode when tripping the circuit breaker.
+    __atomic_store_n(&m_shared->state.strategy_mode, mode, __ATOMIC_RELEASE);
 }
 
 void MainWindow::onKillSwitchClicked()
 {
     if (!m_sharedAttached) return;
-    if (pthread_mutex_lock(&m_shared->mutex) == 0) {
-        m_shared->state.kill_switch = 1;
-        pthread_mutex_unlock(&m_shared->mutex);
-    }
+    __atomic_store_n(&m_shared->state.kill_switch, 1, __ATOMIC_RELEASE);
 }
 
 void MainWindow::onResetCircuitClicked()
 {
     if (!m_sharedAttached) return;
-    if (pthread_mutex_lock(&m_shared->mutex) == 0) {
-        m_shared->state.circuit_tripped = 0;
-        m_shared->state.kill_switch = 0;
-        if (m_shared->state.strategy_mode == 0)
-            m_shared->state.strategy_mode = 2; // resume PAPER
-        pthread_mutex_unlock(&m_shared->mutex);
-    }
+    __atomic_store_n(&m_shared->state.circuit_tripped, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&m_shared->state.kill_switch, 0, __ATOMIC_RELEASE);
+    if (__atomic_load_n(&m_shared->state.strategy_mode, __ATOMIC_ACQUIRE) == 0)
+        __atomic_store_n(&m_shared->state.strategy_mode, 2,
+                         __ATOMIC_RELEASE); // resume PAPER
 }
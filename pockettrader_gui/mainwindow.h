@@ -8,11 +8,15 @@
 #include <QDoubleSpinBox>
 #include <QComboBox>
 #include <QPushButton>
-#include <QTableWidget>
+#include <QTableView>
 #include <QStackedWidget>
-#include <QList>
+#include <QSocketNotifier>
+#include <array>
 #include <cstdint>
 
+#include "tradetapemodel.h"
+#include "runningmedian.h"
+
 extern "C" {
 #include "pockettrader_state.h"   // from ../pockettrader_core_user_space
 }
@@ -37,11 +41,23 @@ private slots:
     void onResetCircuitClicked();
 
 private:
+    enum Page {
+        PageQuotes  = 0,
+        PageControl = 1,
+        PageLatency = 2,
+        PageTape    = 3,
+        PageCount   = 4
+    };
+
     void setupUi();
     void applyStyle();
 
     bool attachSharedMemory();
+    void watchForCore();
+    void openWakeFifo();
     void updateStatusBar(const PocketTraderState &st, std::uint64_t nowNs);
+    void ingestLatencySample(const PocketTraderState &st);
+    void refreshPage(int page, const PocketTraderState &st);
     void updateQuotePanel(const PocketTraderState &st);
     void updateLatencyPanel(const PocketTraderState &st);
     void updateControlPanel(const PocketTraderState &st);
@@ -52,15 +68,39 @@ private:
                         const QString &text,
                         int maxPt,
                         int minPt);
+    void setTextScaled(QLabel *label,
+                       QString &prev,
+                       const QString &text,
+                       int maxPt,
+                       int minPt);
+    void setTextScaledBytes(QLabel *label,
+                            QByteArray &prev,
+                            const char *buf,
+                            int n,
+                            int maxPt,
+                            int minPt);
     void rescaleAllMajorLabels();
 
     // Shared memory
     PocketTraderShared *m_shared;
     bool                m_sharedAttached;
 
-    // Timer
+    // Slow safety timer (stale detection, attach/FIFO retry)
     QTimer *m_timer;
 
+    // Single-shot catch-up used to coalesce FIFO wakeups arriving
+    // faster than the display is worth refreshing
+    QTimer       *m_coalesceTimer;
+    std::uint64_t m_lastRefreshNs;
+
+    // Push wakeups from the core
+    int              m_wakeFd;
+    QSocketNotifier *m_wakeNotifier;
+
+    // /dev/shm watch while waiting for the core to come up
+    int              m_inotifyFd;
+    QSocketNotifier *m_inotifyNotifier;
+
     // Top status bar
     QLabel *m_lblStatusExa;
     QLabel *m_lblStatusExb;
@@ -91,6 +131,7 @@ private:
     QLabel *m_lblTickToTradeVal;
     QLabel *m_lblTickToTradeBest;
     QLabel *m_lblTickToTradeMedian;
+    QLabel *m_lblTickToTradeP95;
 
     // Control panel
     QDoubleSpinBox *m_spinMinSpread;
@@ -99,7 +140,8 @@ private:
     QPushButton    *m_btnKillSwitch;
 
     // Tape
-    QTableWidget *m_tblTrades;
+    QTableView     *m_tblTrades;
+    TradeTapeModel *m_tapeModel;
 
     // Performance metrics labels
     QLabel *m_lblWinRate;
@@ -108,17 +150,81 @@ private:
 
     // Navigation / pages
     QStackedWidget *m_stack;
+    bool            m_pageDirty[PageCount];
     QPushButton *m_btnNavQuotes;
     QPushButton *m_btnNavControls;
     QPushButton *m_btnNavLatency;
     QPushButton *m_btnNavTrades;
 
-    // Local trade stats
-    std::uint32_t m_lastTradesCount;
-    double        m_lastCumulativePnl;
-
-    double        m_bestTickToTradeUs;
-    QList<double> m_tickToTradeSamplesUs;
+    // Last text shown per dynamic label; updates are skipped when the
+    // freshly formatted string is identical, which avoids Qt re-shaping
+    // and repainting a mostly static dashboard 20 times a second.  The
+    // qsnprintf-formatted labels keep the raw bytes, indexed by LabelId,
+    // so the comparison happens before any QString is built at all; the
+    // two status labels come from static QString tables and stay
+    // QString.
+    enum LabelId {
+        TxtMode = 0,
+        TxtTrades,
+        TxtPnl,
+        TxtExaBid,
+        TxtExaAsk,
+        TxtExbBid,
+        TxtExbAsk,
+        TxtSpreadMain,
+        TxtSpreadExaToExb,
+        TxtSpreadExbToExa,
+        TxtMinSpread,
+        TxtLatencyExaVal,
+        TxtLatencyExbVal,
+        TxtTickToTradeVal,
+        TxtTickToTradeBest,
+        TxtTickToTradeMedian,
+        TxtTickToTradeP95,
+        TxtWinRate,
+        TxtProfitFactor,
+        TxtMaxDrawdown,
+        TxtCount
+    };
+
+    QString m_prevStatusExa;
+    QString m_prevStatusExb;
+    std::array<QByteArray, TxtCount> m_prevText;
+
+    // Inputs the performance panel was last formatted from; the panel
+    // is skipped wholesale while they are unchanged (quote motion keeps
+    // frames alive at full rate, trades are far rarer).
+    std::uint32_t m_lastTradesCountPerf;
+    double        m_lastCumPnlPerf;
+    double        m_lastMaxDrawdownPerf;
+
+    static const int kLatencyWindow = 200;   // tick-to-trade samples kept
+
+    double m_bestTickToTradeUs;
+    // Raw sample window as a fixed ring (kept for order statistics
+    // beyond the median): O(1) push, no allocation, contiguous storage.
+    // Oldest sample sits at m_tickToTradeHead once the window is full.
+    std::array<double, kLatencyWindow> m_tickToTradeSamplesUs;
+    int m_tickToTradeHead;
+    int m_tickToTradeCount;
+    // Ingestion counter and the value it had when p95/worst were last
+    // computed; the summarize pass is skipped while no sample arrived.
+    std::uint32_t m_samplesIngested;
+    std::uint32_t m_samplesSummarized;
+    // Incrementally maintained median over the same window; fed in
+    // ingestLatencySample so the latency page no longer sorts all 200
+    // samples on every repaint.
+    RunningMedian m_tickToTradeMedianUs;
+
+    // Hash of the last snapshot (plus derived staleness codes) that was
+    // rendered; frames hashing the same are skipped outright.
+    std::uint64_t m_lastStateHash;
+
+    // Last value pushed into each progress bar; setValue on an unchanged
+    // value still restyles the chunk and repaints.
+    int m_lastPbLatencyExa;
+    int m_lastPbLatencyExb;
+    int m_lastPbTickToTrade;
 };
 
 #endif // MAINWINDOW_H
@@ -6,10 +6,17 @@ TARGET   = pockettrader_gui
 
 SOURCES += \
     main.cpp \
-    mainwindow.cpp
+    mainwindow.cpp \
+    tradetapemodel.cpp
 
 HEADERS += \
-    mainwindow.h
+    fmtprice.h \
+    mainwindow.h \
+    runningmedian.h \
+    tradetapemodel.h
+
+RESOURCES += \
+    pockettrader_gui.qrc
 
 # path to pockettrader_state.h on the BBB
 INCLUDEPATH += ../pockettrader_core_user_space
@@ -0,0 +1,122 @@
+#ifndef RUNNINGMEDIAN_H
+#define RUNNINGMEDIAN_H
+
+#include <queue>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+
+// Sliding-window median over the last W samples using two heaps with
+// lazy deletion: add() is O(log W) amortized, median() is O(1) plus an
+// occasional prune.  This replaces copying and fully sorting the window
+// on every repaint.  Samples that slide out of the window stay in their
+// heap until they surface at a top; m_delayed counts them.
+class RunningMedian
+{
+public:
+    explicit RunningMedian(int window)
+        : m_window(window), m_loSize(0), m_hiSize(0) {}
+
+    bool isEmpty() const { return m_loSize + m_hiSize == 0; }
+
+    void add(double x)
+    {
+        if (m_lo.empty() || x <= m_lo.top()) {
+            m_lo.push(x);
+            ++m_loSize;
+        } else {
+            m_hi.push(x);
+            ++m_hiSize;
+        }
+        m_order.push_back(x);
+        if ((int)m_order.size() > m_window) {
+            remove(m_order.front());
+            m_order.pop_front();
+        }
+        rebalance();
+    }
+
+    // Matches sorted[n / 2] — the upper median for even n — which is
+    // what the previous full-sort path displayed.
+    double median()
+    {
+        const int n = m_loSize + m_hiSize;
+        if (n == 0)
+            return 0.0;
+        if (n & 1) {
+            pruneLo();
+            return m_lo.top();
+        }
+        pruneHi();
+        return m_hi.top();
+    }
+
+private:
+    void remove(double x)
+    {
+        ++m_delayed[x];
+        if (x <= m_lo.top()) {
+            --m_loSize;
+            pruneLo();
+        } else {
+            --m_hiSize;
+            pruneHi();
+        }
+    }
+
+    // Invariant: m_lo holds ceil(n / 2) live samples.
+    void rebalance()
+    {
+        const int n = m_loSize + m_hiSize;
+        while (m_loSize > (n + 1) / 2) {
+            pruneLo();
+            m_hi.push(m_lo.top());
+            m_lo.pop();
+            --m_loSize;
+            ++m_hiSize;
+        }
+        while (m_loSize < (n + 1) / 2) {
+            pruneHi();
+            m_lo.push(m_hi.top());
+            m_hi.pop();
+            ++m_loSize;
+            --m_hiSize;
+        }
+    }
+
+    void pruneLo()
+    {
+        while (!m_lo.empty()) {
+            auto it = m_delayed.find(m_lo.top());
+            if (it == m_delayed.end())
+                break;
+            if (--it->second == 0)
+                m_delayed.erase(it);
+            m_lo.pop();
+        }
+    }
+
+    void pruneHi()
+    {
+        while (!m_hi.empty()) {
+            auto it = m_delayed.find(m_hi.top());
+            if (it == m_delayed.end())
+                break;
+            if (--it->second == 0)
+                m_delayed.erase(it);
+            m_hi.pop();
+        }
+    }
+
+    int m_window;
+    int m_loSize;   // live samples in m_lo (<= median)
+    int m_hiSize;   // live samples in m_hi (> median)
+    std::priority_queue<double> m_lo;                     // max-heap
+    std::priority_queue<double, std::vector<double>,
+                        std::greater<double> > m_hi;      // min-heap
+    std::deque<double> m_order;                           // arrival order
+    std::unordered_map<double, int> m_delayed;            // lazy deletions
+};
+
+#endif // RUNNINGMEDIAN_H
@@ -0,0 +1,155 @@
+#include "tradetapemodel.h"
+
+#include <QTime>
+#include <QPainter>
+#include <QApplication>
+#include <QStyle>
+
+#include "fmtprice.h"
+
+#include <cstdio>
+
+// Fixed four-decimal formatting via the integer divmod emitter; the
+// QString is built once from Latin-1 bytes.  QString::number goes
+// through QLocale and an intermediate heap buffer for the same result.
+static QString fmtFixed4(double v)
+{
+    char b[32];
+    int n = fmtPrice4(b, v);
+    return QString::fromLatin1(b, n);
+}
+
+TradeTapeModel::TradeTapeModel(QObject *parent)
+    : QAbstractTableModel(parent)
+    , m_head(0)
+    , m_count(0)
+{
+}
+
+int TradeTapeModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return m_count;
+}
+
+int TradeTapeModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return kColumns;
+}
+
+QVariant TradeTapeModel::data(const QModelIndex &index, int role) const
+{
+    if (role != Qt::DisplayRole || !index.isValid())
+        return QVariant();
+    if (index.row() < 0 || index.row() >= m_count)
+        return QVariant();
+
+    const TradeRow &r = m_rows[(m_head + index.row()) % kMaxRows];
+    switch (index.column()) {
+    case 0: {
+        // snprintf beats QTime::toString, which re-parses the format
+        // string on every call.
+        const int s = r.timeMs / 1000;
+        char b[16];
+        int n = std::snprintf(b, sizeof b, "%02d:%02d:%02d",
+                              s / 3600, (s / 60) % 60, s % 60);
+        return QString::fromLatin1(b, n);
+    }
+    case 1:
+        return r.dir ? QStringLiteral("EXA→EXB") : QStringLiteral("EXB→EXA");
+    case 2:
+        return fmtFixed4(r.spread);
+    case 3:
+        return fmtFixed4(r.size);
+    case 4:
+        return fmtFixed4(r.pnl);
+    }
+    return QVariant();
+}
+
+QVariant TradeTapeModel::headerData(int section,
+                                    Qt::Orientation orientation,
+                                    int role) const
+{
+    if (role != Qt::DisplayRole || orientation != Qt::Horizontal)
+        return QVariant();
+
+    switch (section) {
+    case 0: return QStringLiteral("Time");
+    case 1: return QStringLiteral("Dir");
+    case 2: return QStringLiteral("Spread");
+    case 3: return QStringLiteral("Size");
+    case 4: return QStringLiteral("PnL");
+    }
+    return QVariant();
+}
+
+void TradeTapeModel::appendTrade(const TradeRow &row)
+{
+    if (m_count < kMaxRows) {
+        beginInsertRows(QModelIndex(), m_count, m_count);
+        m_rows[(m_head + m_count) % kMaxRows] = row;
+        ++m_count;
+        endInsertRows();
+        return;
+    }
+
+    // Tape is full: reuse the oldest slot in place and advance the
+    // head.  Every visible row shifts up by one, so signal the whole
+    // tape once rather than paying insert-row plus remove-row layout
+    // passes per trade.
+    m_rows[m_head] = row;
+    m_head = (m_head + 1) % kMaxRows;
+    emit dataChanged(index(0, 0), index(kMaxRows - 1, kColumns - 1));
+}
+
+TradeTapeDelegate::TradeTapeDelegate(QObject *parent)
+    : QStyledItemDelegate(parent)
+{
+}
+
+void TradeTapeDelegate::paint(QPainter *painter,
+                              const QStyleOptionViewItem &option,
+                              const QModelIndex &index) const
+{
+    QStyleOptionViewItem opt = option;
+    initStyleOption(&opt, index);
+
+    // Let the style paint the cell panel (alternating colors, QSS) with
+    // the text stripped, then draw cached pre-shaped glyphs on top.
+    const QString text = opt.text;
+    opt.text.clear();
+    QStyle *style = opt.widget ? opt.widget->style() : QApplication::style();
+    style->drawControl(QStyle::CE_ItemViewItem, &opt, painter, opt.widget);
+
+    if (text.isEmpty())
+        return;
+
+    auto it = m_staticText.find(text);
+    if (it == m_staticText.end()) {
+        if (m_staticText.size() >= 256)
+            m_staticText.clear();
+        QStaticText st(text);
+        st.setTextFormat(Qt::PlainText);
+        it = m_staticText.insert(text, st);
+    }
+
+    painter->setFont(opt.font);
+    painter->setPen(opt.palette.color(QPalette::Text));
+    const QSizeF ts = it.value().size();
+    painter->drawStaticText(
+        QPointF(opt.rect.x() + 4,
+                opt.rect.y() + (opt.rect.height() - ts.height()) / 2.0),
+        it.value());
+}
+
+QSize TradeTapeDelegate::sizeHint(const QStyleOptionViewItem &option,
+                                  const QModelIndex &index) const
+{
+    QSize sz = QStyledItemDelegate::sizeHint(option, index);
+    sz.setHeight(kRowHeight);
+    return sz;
+}
@@ -0,0 +1,74 @@
+#ifndef TRADETAPEMODEL_H
+#define TRADETAPEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QStyledItemDelegate>
+#include <QStaticText>
+#include <QHash>
+#include <array>
+
+// One executed trade as plain data.  Display text is formatted on
+// demand in data(), so appending a trade allocates no per-cell objects
+// (the QTableWidget it replaces heap-allocated five QTableWidgetItems
+// per row) and the view only ever formats the rows it actually paints.
+struct TradeRow {
+    int     timeMs;   // QTime::msecsSinceStartOfDay() at ingest
+    quint8  dir;      // 1 = EXA->EXB, 0 = EXB->EXA
+    float   spread;
+    float   size;
+    float   pnl;
+};
+
+class TradeTapeModel : public QAbstractTableModel
+{
+public:
+    explicit TradeTapeModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role) const override;
+    QVariant headerData(int section,
+                        Qt::Orientation orientation,
+                        int role) const override;
+
+    // Append at the tail, dropping the oldest row beyond kMaxRows.
+    void appendTrade(const TradeRow &row);
+
+    static const int kMaxRows = 50;
+    static const int kColumns = 5;
+
+private:
+    // Fixed-capacity ring: visible row r lives in slot (head + r) %
+    // kMaxRows.  Once the tape is full, appending overwrites the oldest
+    // slot and advances head — no allocation, no element shifting and
+    // no row insert/remove geometry work in the view, just one
+    // dataChanged covering the tape.
+    std::array<TradeRow, kMaxRows> m_rows;
+    int m_head;    // slot of the oldest (topmost) row
+    int m_count;   // rows filled, saturates at kMaxRows
+};
+
+// Paints tape cells from a cache of pre-shaped QStaticText glyph runs.
+// Tape strings repeat heavily (direction tags, a narrow band of prices),
+// so most paints skip text shaping entirely; rows are a fixed height,
+// configured on the view's vertical header.
+class TradeTapeDelegate : public QStyledItemDelegate
+{
+public:
+    explicit TradeTapeDelegate(QObject *parent = nullptr);
+
+    void paint(QPainter *painter,
+               const QStyleOptionViewItem &option,
+               const QModelIndex &index) const override;
+    QSize sizeHint(const QStyleOptionViewItem &option,
+                   const QModelIndex &index) const override;
+
+    static const int kRowHeight = 14;
+
+private:
+    // Bounded cache of shaped text; flushed wholesale when it fills,
+    // which is cheaper and simpler than tracking true LRU order.
+    mutable QHash<QString, QStaticText> m_staticText;
+};
+
+#endif // TRADETAPEMODEL_H